@@ -24,6 +24,10 @@ def run_tests(executable):
     wrapper('hllc')
     wrapper('hlle')
 
+    # same as hllc, but with Method:mhd_vlct:tile_size > 0
+    EnzoEWrapper(executable,
+                 'input/vlct/dual_energy_cloud/hllc_cloud_tiled.in')()
+
 def slice_asym(grid, slice_ax, slice_ind, flip_across):
     """
     For a given slice through a grid, this function quantifies
@@ -77,6 +81,28 @@ def check_cloud_asym(fname, name, max_asym):
             out.append(True)
     return out
 
+def check_identical(fname_ref, fname, name):
+    """
+    Checks that every field of the output in fname is bitwise identical
+    to that in fname_ref
+    """
+    ds_ref = yt.load(fname_ref)
+    ds = yt.load(fname)
+    grid_ref = ds_ref.covering_grid(0, ds_ref.domain_left_edge,
+                                    ds_ref.domain_dimensions)
+    grid = ds.covering_grid(0, ds.domain_left_edge, ds.domain_dimensions)
+
+    out = []
+    for field in ds_ref.field_list:
+        if not np.array_equal(grid_ref[field].v, grid[field].v):
+            max_diff = np.max(np.abs(grid_ref[field].v - grid[field].v))
+            print(("FAILED: {} field {} differs from the reference run by "
+                   "up to {}").format(name, field[1], max_diff))
+            out.append(False)
+        else:
+            out.append(True)
+    return out
+
 def analyze_tests():
     r = []
     r += check_cloud_asym('hlld_cloud_0.0625/hlld_cloud_0.0625.block_list',
@@ -85,6 +111,10 @@ def analyze_tests():
                           'hllc_cloud', 4.6e-13)
     r += check_cloud_asym('hlle_cloud_0.0625/hlle_cloud_0.0625.block_list',
                           'hlle_cloud', 3.2e-13)
+    r += check_identical('hllc_cloud_0.0625/hllc_cloud_0.0625.block_list',
+                         ('hllc_cloud_tiled_0.0625/'
+                          'hllc_cloud_tiled_0.0625.block_list'),
+                         'hllc_cloud_tiled')
     n_passed = np.sum(r)
     n_tests = len(r)
     print("{:d} Tests passed out of {:d} Tests.".format(n_passed,n_tests))
@@ -92,7 +122,8 @@ def analyze_tests():
     return n_passed == n_tests
 
 def cleanup():
-    dir_names = ['hlld_cloud_0.0625', 'hllc_cloud_0.0625', 'hlle_cloud_0.0625']
+    dir_names = ['hlld_cloud_0.0625', 'hllc_cloud_0.0625', 'hlle_cloud_0.0625',
+                 'hllc_cloud_tiled_0.0625']
     for dir_name in dir_names:
         if os.path.isdir(dir_name):
             shutil.rmtree(dir_name)
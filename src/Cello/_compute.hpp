@@ -25,6 +25,7 @@ extern const char * solve_string[];
 // System includes
 //----------------------------------------------------------------------
 
+#include <complex>
 #include <map>
 #include <memory>
 #include <set>
@@ -37,6 +38,7 @@ extern const char * solve_string[];
 //----------------------------------------------------------------------
 
 #include "compute_Compute.hpp"
+#include "compute_Fft.hpp"
 #include "compute_Matrix.hpp"
 #include "compute_Solver.hpp"
 #include "compute_SolverNull.hpp"
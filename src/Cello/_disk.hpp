@@ -12,6 +12,9 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <string>
 
 //----------------------------------------------------------------------
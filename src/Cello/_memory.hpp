@@ -16,12 +16,15 @@
 
 #include <stack>
 #include <memory>
+#include <map>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Component class includes
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_Workspace.hpp"
 
 #endif /* _MEMORY_HPP */
 
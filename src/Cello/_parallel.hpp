@@ -17,6 +17,7 @@
 #include <string>
 #include <map>
 #include <limits>
+#include <algorithm>
 
 #include <math.h>
 #include <stdio.h>
@@ -30,6 +31,7 @@
 //----------------------------------------------------------------------
 
 #include "parallel.def"
+#include "parallel_loop.hpp"
 
 #endif /* _PARALLEL_HPP */
 
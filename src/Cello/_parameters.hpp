@@ -43,6 +43,7 @@ extern const char * parameter_type_name [];
 //----------------------------------------------------------------------
 
 #include "parse.h"
+#include "parameters_ParamExpr.hpp"
 #include "parameters_Config.hpp"
 #include "parameters_Param.hpp"
 #include "parameters_ParamNode.hpp"
@@ -372,7 +372,59 @@ namespace cello {
   {
     FieldDescr * field_descr = cello::field_descr();
     Config   * config  = (Config *) cello::config();
+
+    // storage precision of field groups, set once all fields and
+    // groups are defined (and before history fields copy precision)
+    Problem * problem = cello::problem();
+    for (const auto & group_precision : config->field_group_precision) {
+      for (int id=0; id<field_descr->num_permanent(); id++) {
+        const std::string field_name = field_descr->field_name(id);
+        if (field_descr->groups()->is_in (field_name,group_precision.first)) {
+          field_descr->set_precision(id, group_precision.second);
+          if (field_descr->precision(id) == default_precision) continue;
+          // reject precisions that a method or initializer cannot access
+          Method * method;
+          for (int im=0; problem && (method = problem->method(im)); im++) {
+            ASSERT3("cello::finalize_fields()",
+                    "Method \"%s\" requires field \"%s\" at the default "
+                    "precision: remove Group:%s:precision",
+                    method->name().c_str(), field_name.c_str(),
+                    group_precision.first.c_str(),
+                    method->supports_field_precision(field_name));
+          }
+          Initial * initial;
+          for (int ii=0; problem && (initial = problem->initial(ii)); ii++) {
+            ASSERT3("cello::finalize_fields()",
+                    "Initial \"%s\" requires field \"%s\" at the default "
+                    "precision: remove Group:%s:precision",
+                    config->initial_list[ii].c_str(), field_name.c_str(),
+                    group_precision.first.c_str(),
+                    initial->supports_field_precision(field_name));
+          }
+        }
+      }
+    }
+
+    field_descr->set_history_fields(config->field_history_fields);
     field_descr->reset_history(config->field_history);
+
+    // when subcycling, ghost zones sent by Blocks between steps are
+    // interpolated in time, so refreshed fields must have a history
+
+    Simulation * simulation = cello::simulation();
+    if (config->stopping_subcycle && simulation) {
+      for (int ir=0; ir<simulation->refresh_count(); ir++) {
+        for (int id : simulation->refresh_list(ir).field_list_src()) {
+          ASSERT2("cello::finalize_fields()",
+                  "Stopping:subcycle requires a history for field \"%s\" "
+                  "refreshed by \"%s\": add it to Field:history_fields",
+                  field_descr->field_name(id).c_str(),
+                  simulation->refresh_name(ir).c_str(),
+                  (! field_descr->is_permanent(id)) ||
+                  field_descr->has_history(id));
+        }
+      }
+    }
   }
 
   //---------------------------------------------------------------------- 
@@ -20,7 +20,8 @@ MsgRefresh::MsgRefresh()
       is_local_(true),
       id_refresh_(-1),
       data_msg_(nullptr),
-      buffer_(nullptr)
+      buffer_(nullptr),
+      packed_(nullptr)
 {
   ++counter[cello::index_static()];
 }
@@ -34,6 +35,8 @@ MsgRefresh::~MsgRefresh()
   data_msg_ = nullptr;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  delete [] packed_;
+  packed_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -126,11 +129,33 @@ void MsgRefresh::update (Data * data)
   if (!is_local_) {
       CkFreeMsg (buffer_);
       buffer_ = nullptr;
+      delete [] packed_;
+      packed_ = nullptr;
   }
 }
 
 //----------------------------------------------------------------------
 
+void MsgRefresh::load_packed (int n, const char * buffer)
+{
+  ASSERT("MsgRefresh::load_packed()",
+         "data_msg_ must not already be set",
+         (data_msg_ == nullptr));
+
+  is_local_ = false;
+
+  // copy the buffer since the message may be queued until the
+  // receiving Block is ready
+
+  packed_ = new char [n];
+  memcpy (packed_,buffer,n);
+
+  data_msg_ = new DataMsg;
+  data_msg_->load_data(packed_);
+}
+
+//----------------------------------------------------------------------
+
 void MsgRefresh::print (const char * message, FILE * fp_in)
 {
   FILE * fp = fp_in ? fp_in : stdout;
@@ -144,4 +169,5 @@ void MsgRefresh::print (const char * message, FILE * fp_in)
   fprintf (fp,"%s MSG_REFRESH is_local_ %d\n",message,is_local_?1:0);
   fprintf (fp,"%s MSG_REFRESH id_refresh_ %d\n",message,id_refresh_);
   fprintf (fp,"%s MSG_REFRESH buffer_ %p\n",message,buffer_);
+  fprintf (fp,"%s MSG_REFRESH packed_ %p\n",message,(void*)packed_);
 }
@@ -48,6 +48,10 @@ public: // interface
   /// Update the Data with data stored in this message
   void update (Data * data);
 
+  /// Initialize the DataMsg from a copy of the given packed buffer,
+  /// e.g. a face extracted from an aggregated refresh message
+  void load_packed (int n, const char * buffer);
+
   void print(const char * message, FILE * fp=nullptr);
   
 public: // static methods
@@ -71,6 +75,9 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Copy of packed DataMsg data owned by the message (see load_packed())
+  char * packed_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
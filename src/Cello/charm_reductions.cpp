@@ -14,17 +14,21 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
   long long num_sum = ((long long*) (msgs[0]->getData()))[0];
   long long num_max = ((long long*) (msgs[0]->getData()))[1];
 
+  // the array length grows with the number of regions, timers and
+  // memory sampling groups, so only check that it matches the message
   const int length = 2 + num_sum + num_max;
   std::vector<long long> accum;
-  ASSERT1 ("r_reduce_performance",
-	   "Sanity check failed on expected accumulator array %d",
-	   length, (length < 500));
-  accum.resize(length);
-  accum.clear();
-
-  // save length
-  accum [0] = num_sum;
-  accum [1] = num_max;
+  ASSERT3 ("r_reduce_performance",
+	   "Sanity check failed on expected accumulator array %d "
+	   "(num_sum %lld num_max %lld)",
+	   length, num_sum, num_max,
+	   (num_sum >= 0) && (num_max >= 0) &&
+	   ((long unsigned)(msgs[0]->getSize()) == length*sizeof(long long)));
+
+  // initialize with the first contribution so that maxima of
+  // negative values (e.g. negated minima) are reduced correctly
+  long long * values_0 = (long long *) msgs[0]->getData();
+  accum.assign(values_0, values_0 + length);
 
   // sum remaining values
   for (int i=0; i<n; i++) {
@@ -33,7 +37,9 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
 	    msgs[i]->getSize(),length*sizeof(long long),num_sum,num_max,
 	    (((long unsigned)(msgs[i]->getSize()) ==
               length*sizeof(long long))));
-      
+
+    if (i == 0) continue;
+
     long long * values = (long long *) msgs[i]->getData();
     int j = 2;
     for (int count=1; count <= num_sum; count++) {
@@ -0,0 +1,181 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     compute_Fft.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the Fft class
+
+#include "compute.hpp"
+
+//----------------------------------------------------------------------
+
+Fft::Fft (int n) throw()
+  : n_(n),
+    m_(1),
+    twiddle_(),
+    bitrev_(),
+    chirp_(),
+    kernel_()
+{
+  ASSERT1 ("Fft::Fft()",
+           "Transform length %d must be positive",
+           n, (n > 0));
+
+  const bool is_power_of_two = ((n & (n-1)) == 0);
+
+  // radix-2 transform length
+  m_ = 1;
+  if (is_power_of_two) {
+    m_ = n;
+  } else {
+    while (m_ < 2*n - 1) m_ <<= 1;
+  }
+
+  int log2m = 0;
+  while ((1 << log2m) < m_) ++log2m;
+
+  bitrev_.resize(m_);
+  for (int i=0; i<m_; i++) {
+    int j = 0;
+    for (int b=0; b<log2m; b++) j |= ((i >> b) & 1) << (log2m - 1 - b);
+    bitrev_[i] = j;
+  }
+
+  twiddle_.resize(m_/2);
+  for (int k=0; k<m_/2; k++) {
+    twiddle_[k] = std::polar(1.0, -2.0*cello::pi*k/m_);
+  }
+
+  if (! is_power_of_two) {
+
+    // chirp c[k] = exp(-pi i k^2 / n), with k^2 reduced mod 2n to
+    // keep the argument small
+
+    chirp_.resize(n);
+    for (long long k=0; k<n; k++) {
+      const long long k2 = (k*k) % (2*n);
+      chirp_[k] = std::polar(1.0, -cello::pi*k2/n);
+    }
+
+    // convolution kernel conj(c[k]) for -(n-1) <= k <= n-1, wrapped
+    // to length m_
+
+    kernel_.assign(m_,complex_type(0.0,0.0));
+    kernel_[0] = std::conj(chirp_[0]);
+    for (int k=1; k<n; k++) {
+      kernel_[k] = kernel_[m_-k] = std::conj(chirp_[k]);
+    }
+    radix2_(kernel_.data(),-1);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Fft::forward_real (const double * x0, const double * x1,
+                        complex_type * y0, complex_type * y1) const throw()
+{
+  const int n = n_;
+  std::vector<complex_type> z(n);
+  for (int j=0; j<n; j++) {
+    z[j] = complex_type(x0[j], x1 ? x1[j] : 0.0);
+  }
+
+  forward (z.data());
+
+  // separate the transforms of the real and imaginary parts using
+  // the Hermitian symmetry of each
+
+  for (int k=0; k<=n/2; k++) {
+    const complex_type zp = z[k];
+    const complex_type zm = std::conj(z[(n-k) % n]);
+    y0[k] = 0.5*(zp + zm);
+    if (y1) y1[k] = complex_type(0.0,-0.5)*(zp - zm);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Fft::backward_real (const complex_type * y0, const complex_type * y1,
+                         double * x0, double * x1) const throw()
+{
+  const int n = n_;
+  const complex_type i1(0.0,1.0);
+  std::vector<complex_type> z(n);
+
+  for (int k=0; k<=n/2; k++) {
+    complex_type a = y0[k];
+    complex_type b = y1 ? y1[k] : complex_type(0.0,0.0);
+    if (k == 0 || 2*k == n) {
+      a = a.real();
+      b = b.real();
+    }
+    z[k] = a + i1*b;
+    if (k > 0 && 2*k != n) {
+      z[n-k] = std::conj(a) + i1*std::conj(b);
+    }
+  }
+
+  backward (z.data());
+
+  for (int j=0; j<n; j++) {
+    x0[j] = z[j].real();
+    if (x1) x1[j] = z[j].imag();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Fft::transform_ (complex_type * a, int sign) const throw()
+{
+  if (chirp_.empty()) {
+
+    radix2_(a,sign);
+
+  } else {
+
+    // Bluestein: the backward transform is the conjugate of the
+    // forward transform of the conjugate
+
+    const int n = n_;
+    std::vector<complex_type> w(m_,complex_type(0.0,0.0));
+    for (int j=0; j<n; j++) {
+      const complex_type aj = (sign < 0) ? a[j] : std::conj(a[j]);
+      w[j] = aj * chirp_[j];
+    }
+    radix2_(w.data(),-1);
+    for (int k=0; k<m_; k++) w[k] *= kernel_[k];
+    radix2_(w.data(),+1);
+    const double scale = 1.0 / m_;
+    for (int k=0; k<n; k++) {
+      const complex_type ak = w[k] * chirp_[k] * scale;
+      a[k] = (sign < 0) ? ak : std::conj(ak);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Fft::radix2_ (complex_type * a, int sign) const throw()
+{
+  const int m = m_;
+
+  for (int i=0; i<m; i++) {
+    const int j = bitrev_[i];
+    if (i < j) std::swap(a[i],a[j]);
+  }
+
+  for (int len=2; len<=m; len<<=1) {
+    const int half = len/2;
+    const int step = m/len;
+    for (int i=0; i<m; i+=len) {
+      for (int k=0; k<half; k++) {
+        const complex_type w = (sign < 0) ?
+          twiddle_[k*step] : std::conj(twiddle_[k*step]);
+        const complex_type u = a[i+k];
+        const complex_type v = a[i+k+half]*w;
+        a[i+k]      = u + v;
+        a[i+k+half] = u - v;
+      }
+    }
+  }
+}
@@ -0,0 +1,91 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     compute_Fft.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Compute] Declaration of the Fft class
+
+#ifndef COMPUTE_FFT_HPP
+#define COMPUTE_FFT_HPP
+
+#include <complex>
+
+class Fft {
+
+  /// @class    Fft
+  /// @ingroup  Compute
+  /// @brief    [\ref Compute] Self-contained one-dimensional FFT of a
+  /// given length
+  ///
+  /// Power-of-two lengths use an iterative radix-2 Cooley-Tukey
+  /// transform; other lengths are computed with Bluestein's algorithm
+  /// as a convolution using a power-of-two transform, so all lengths
+  /// are O(n log n).  Transforms are unnormalized: backward(forward(a))
+  /// returns n*a.  A plan is read-only after construction and may be
+  /// shared between threads.
+
+public: // interface
+
+  typedef std::complex<double> complex_type;
+
+  /// Create a plan for transforms of length n
+  Fft (int n) throw();
+
+  /// Return the transform length
+  int size() const throw()
+  { return n_; }
+
+  /// In-place forward transform, a[k] <- sum_j a[j] exp(-2 pi i j k / n)
+  void forward (complex_type * a) const throw()
+  { transform_(a,-1); }
+
+  /// In-place backward transform, a[k] <- sum_j a[j] exp(+2 pi i j k / n)
+  void backward (complex_type * a) const throw()
+  { transform_(a,+1); }
+
+  /// Forward transform of the two real sequences x0 and x1 using a
+  /// single complex transform.  Returns the n/2+1 non-negative
+  /// frequency coefficients of each in y0 and y1.  x1 and y1 may be
+  /// nullptr.
+  void forward_real (const double * x0, const double * x1,
+                     complex_type * y0, complex_type * y1) const throw();
+
+  /// Inverse of forward_real(): backward transform of the two
+  /// Hermitian sequences given by their n/2+1 non-negative frequency
+  /// coefficients y0 and y1, returning real sequences x0 and x1.  The
+  /// imaginary parts of the zero (and for even n, Nyquist) coefficients
+  /// are ignored.  y1 and x1 may be nullptr.
+  void backward_real (const complex_type * y0, const complex_type * y1,
+                      double * x0, double * x1) const throw();
+
+private: // functions
+
+  /// Transform of length n_ with exponent sign
+  void transform_ (complex_type * a, int sign) const throw();
+
+  /// Power-of-two transform of length m_ with exponent sign
+  void radix2_ (complex_type * a, int sign) const throw();
+
+private: // attributes
+
+  /// Transform length
+  int n_;
+
+  /// Length of the radix-2 transform: n_ if a power of two, otherwise
+  /// the Bluestein convolution length (a power of two >= 2 n_ - 1)
+  int m_;
+
+  /// Radix-2 twiddle factors exp(-2 pi i k / m_) for k < m_/2
+  std::vector<complex_type> twiddle_;
+
+  /// Bit-reversal permutation of length m_
+  std::vector<int> bitrev_;
+
+  /// Bluestein chirp exp(-pi i k^2 / n_) for k < n_ (empty if radix-2)
+  std::vector<complex_type> chirp_;
+
+  /// Forward transform of the Bluestein convolution kernel
+  std::vector<complex_type> kernel_;
+};
+
+#endif /* COMPUTE_FFT_HPP */
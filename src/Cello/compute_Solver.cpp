@@ -47,7 +47,8 @@ Solver::Solver (std::string name,
     solve_type_(solve_type),
     index_prolong_(index_prolong),
     index_restrict_(index_restrict),
-    ir_post_(-1)
+    ir_post_(-1),
+    index_timer_(-1)
 {
   FieldDescr * field_descr = cello::field_descr();
   ix_ = field_descr->field_id(field_x);
@@ -71,7 +72,8 @@ Solver::Solver () throw()
     solve_type_(solve_leaf),
     index_prolong_(0),
     index_restrict_(0),
-    ir_post_(-1)
+    ir_post_(-1),
+    index_timer_(-1)
 {
   ir_post_ = add_refresh_();
 }
@@ -150,6 +152,9 @@ void Solver::begin_(Block * block)
 
 void Solver::end_(Block * block)
 {
+  cello::simulation()->performance()->timer_accumulate
+    (index_timer_, block->solver_time());
+
   int index = block->pop_solver();
 #ifdef TRACE_SOLVER  
   if (block->cycle() >= CYCLE)
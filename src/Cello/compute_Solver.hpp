@@ -51,7 +51,8 @@ public: // interface
       solve_type_(solve_leaf),
       index_prolong_(0),
       index_restrict_(0),
-      ir_post_(-1)
+      ir_post_(-1),
+      index_timer_(-1)
   { }
 
   /// Destructor
@@ -79,6 +80,7 @@ public: // interface
     p | index_prolong_;
     p | index_restrict_;
     p | ir_post_;
+    p | index_timer_;
   }
 
   Refresh * refresh(size_t index=0) ;
@@ -92,6 +94,14 @@ public: // interface
   int index() const
   { return index_; }
 
+  /// Set the index of the Performance timer for this Solver
+  void set_index_timer (int index_timer)
+  { index_timer_ = index_timer; }
+
+  /// Return the index of the Performance timer for this Solver
+  int index_timer() const
+  { return index_timer_; }
+
   void set_field_x (int ix)
   { ix_ = ix;  }
   
@@ -251,6 +261,9 @@ protected: // attributes
   
   /// New Refresh id for after the solver
   int ir_post_;
+
+  /// Index of the Performance timer for per-Block solve times
+  int index_timer_;
 };
 
 #endif /* COMPUTE_SOLVER_HPP */
@@ -145,6 +145,10 @@ void Block::adapt_barrier_()
 void Block::adapt_next_()
 {
   TRACE_ADAPT("adapt_next contribute called_",this);
+
+  // neighbor levels may change, so cached refresh faces are invalid
+  refresh_face_clear_();
+
   update_levels_();
 
   level_next_ = adapt_.level_min();
@@ -254,7 +258,12 @@ bool Block::do_adapt_()
 {
   int adapt_interval = cello::config()->adapt_interval;
 
-  return ((adapt_interval && ((cycle_ % adapt_interval) == 0)));
+  // When subcycling, only adapt when all levels are synchronized
+
+  const bool is_sync = (! cello::config()->stopping_subcycle) ||
+    cello::simulation()->subcycle_sync(cycle_);
+
+  return (is_sync && adapt_interval && ((cycle_ % adapt_interval) == 0));
 }
 
 //----------------------------------------------------------------------
@@ -265,7 +274,11 @@ bool Block::do_adapt_()
 /// Return if not a leaf; otherwise, apply all Refine refinement
 /// criteria to the Block, and set level_desired accordingly:
 /// level+1 if it needs to refine, level - 1 if it can coarsen,
-/// or level.
+/// or level.  Criteria that support per-cell evaluation
+/// (Refine::prepare()) over the same cells are evaluated together in
+/// a single sweep.  Once one criteria requests refinement the result
+/// cannot change, so remaining criteria are skipped unless they
+/// write an output field.
 ///
 /// @param[in]  level_maximum   Maximum level to refine
 ///
@@ -283,16 +296,38 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   Problem * problem = cello::problem();
   Refine * refine;
 
+  std::vector<Refine *> refine_fused;
+  int m3[3], i3[3], n3[3];
+
   int index_refine = 0;
   while ((refine = problem->refine(index_refine++))) {
 
     Schedule * schedule = refine->schedule();
 
+    // refinement already certain: skip criteria that only vote
+    if (adapt == adapt_refine && ! refine->has_output()) continue;
+
     if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
-      adapt = std::max(adapt,refine->apply(this));
+      int mr3[3], ir3[3], nr3[3];
+      if (refine->prepare(this,mr3,ir3,nr3) &&
+          (refine_fused.empty() ||
+           (std::equal(mr3,mr3+3,m3) && std::equal(ir3,ir3+3,i3) &&
+            std::equal(nr3,nr3+3,n3)))) {
+        std::copy_n(mr3,3,m3);
+        std::copy_n(ir3,3,i3);
+        std::copy_n(nr3,3,n3);
+        refine_fused.push_back(refine);
+      } else {
+        adapt = std::max(adapt,refine->apply(this));
+      }
     }
 
   }
+
+  if (adapt != adapt_refine && ! refine_fused.empty()) {
+    adapt = std::max
+      (adapt,Refine::apply_fused(this,refine_fused,m3,i3,n3));
+  }
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
 
@@ -33,6 +33,13 @@ void Block::compute_begin_ ()
 
   cello::simulation()->set_phase(phase_compute);
 
+  // When subcycling, save fields at the start of the Block's step for
+  // interpolating ghost zone values in time
+
+  if (cello::config()->stopping_subcycle && subcycle_active()) {
+    data()->field().save_history(time_);
+  }
+
   index_method_ = 0;
   compute_next_();
 }
@@ -87,6 +94,19 @@ void Block::compute_continue_ ()
     (schedule==NULL) ||
     (schedule->write_this_cycle(cycle_,time_));
 
+  // When subcycling, only advance Blocks whose level begins a step
+
+  if (method->is_subcycled() && ! subcycle_active()) {
+    is_scheduled = false;
+  }
+
+  // ...and only apply methods requiring all Blocks at synchronized cycles
+
+  if (method->is_synchronized() && cello::config()->stopping_subcycle &&
+      ! cello::simulation()->subcycle_sync(cycle_)) {
+    is_scheduled = false;
+  }
+
   if (is_scheduled) {
     TRACE2 ("Block::compute_continue() method = %d %p\n",
 	    index_method_,method); fflush(stdout);
@@ -99,8 +119,27 @@ void Block::compute_continue_ ()
 #endif
     // Apply the method to the Block
 
+    Performance * performance = cello::simulation()->performance();
+
+    // attribute sampled allocations to the method
+    Memory * memory = Memory::instance();
+    const bool is_sampling = memory && memory->is_sampling();
+    const int index_group = is_sampling ? memory->group_index() : 0;
+    if (is_sampling) {
+      memory->set_group_index
+        (performance->timer_memory_group(method->index_timer()));
+    }
+
+    const double time_start = CmiWallTimer();
+
     method->compute (this);
 
+    const double time_method = CmiWallTimer() - time_start;
+    compute_time_ += time_method;
+    performance->timer_accumulate (method->index_timer(), time_method);
+
+    if (is_sampling) memory->set_group_index(index_group);
+
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
   } else {
@@ -137,19 +176,39 @@ void Block::compute_end_ ()
   //  traceUserBracketEvent(10,time_start, CmiWallTimer());
 #endif
 
-  // Push back fields if saving old ones
-  data()->field().save_history(time_);
+  if (! cello::config()->stopping_subcycle) {
+
+    // Push back fields if saving old ones
+    data()->field().save_history(time_);
 
-  // delete fluxes
-  data()->flux_data()->deallocate();
+    // delete fluxes
+    data()->flux_data()->deallocate();
 
-  // Update block cycle and time
-  set_cycle (cycle_ + 1);
-  set_time  (time_  + dt_);
+    // Update block cycle and time
+    set_cycle (cycle_ + 1);
+    set_time  (time_  + dt_);
+
+    // Update Simulation cycle and time (redundant)
+    cello::simulation()->set_cycle(cycle_);
+    cello::simulation()->set_time(time_);
+
+  } else {
 
-  // Update Simulation cycle and time (redundant)
-  cello::simulation()->set_cycle(cycle_);
-  cello::simulation()->set_time(time_);
+    // When subcycling, fluxes are kept until the end of the Block's
+    // step for flux correction, and the Block time only advances at
+    // the start of its step
+
+    if (subcycle_closing()) data()->flux_data()->deallocate();
+
+    const bool is_active = subcycle_active();
+
+    set_cycle (cycle_ + 1);
+    if (is_active) set_time (time_ + dt_);
+
+    Simulation * simulation = cello::simulation();
+    simulation->set_cycle(cycle_);
+    simulation->set_time(simulation->subcycle_time(cycle_));
+  }
 
   compute_exit_();
 
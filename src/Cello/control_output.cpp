@@ -70,13 +70,18 @@ void Problem::output_next(Simulation * simulation) throw()
 
   Output * output;
 
+  // When subcycling, only output when all levels are synchronized
+
+  const bool is_sync = (! cello::config()->stopping_subcycle) ||
+    simulation->subcycle_sync(cycle);
+
   // Find next schedule output (index_output_ initialized to -1)
 
   do {
 
     output = this->output(++index_output_);
 
-  } while (output && ! output->is_scheduled(cycle, time));
+  } while (output && ! (is_sync && output->is_scheduled(cycle, time)));
 
   // assert (! output) || ( output->is_scheduled() )
   
@@ -109,6 +114,9 @@ void Simulation::output_start(int index_output)
 {
   TRACE_OUTPUT("Simulation::output_start()");
   Output * output = problem()->output(index_output);
+  // this process's own data plus that of its children in the
+  // reduction tree (not pup'ed, so reset here)
+  output->sync_write()->set_stop(1 + output->num_children());
   output->init();
   output->open();
   index_output_ = index_output;
@@ -197,36 +205,50 @@ void Problem::output_wait(Simulation * simulation) throw()
   
   Output * output = this->output(index_output_);
 
-  const int ip = CkMyPe();
-  const int np = CkNumPes();
-  const int ip_write = output->process_writer();
+  if (output->is_writer() || output->num_children() > 0) {
 
-  if (ip == ip_write) {
+    // Wait for data from child processes (if any)
 
     output_write(simulation,0,0);
 
   } else {
 
-    int n=0;  char * buffer = 0;
+    output_send_(simulation);
+
+  }
+}
 
-    // Copy / alias buffer array of data to send
-    output->prepare_remote(&n,&buffer);
+//----------------------------------------------------------------------
 
-    // Send data to writing process
-    proxy_simulation[ip_write].p_output_write (n, buffer);
+void Problem::output_send_(Simulation * simulation) throw()
+{
+  TRACE_OUTPUT("Problem::output_send_()");
 
-    // Deallocate buffer
-    output->cleanup_remote(&n,&buffer);
+  Output * output = this->output(index_output_);
 
-    output->close();
-    output->finalize();
-    output_next(simulation);
-    
-    const int stride = output->stride_wait();
-    const int ip_next = ip+1;
-    if (ip_next%stride != 0 && ip_next < np) {
-      proxy_simulation[ip_next].p_output_start(index_output_);
-    }
+  const int ip = CkMyPe();
+  const int np = CkNumPes();
+
+  int n=0;  char * buffer = 0;
+
+  // Copy / alias buffer array of data to send
+  output->prepare_remote(&n,&buffer);
+
+  // Send data to parent process, which merges it with its own and
+  // that of its other children before sending it on to the writer
+  proxy_simulation[output->process_parent()].p_output_write (n, buffer);
+
+  // Deallocate buffer
+  output->cleanup_remote(&n,&buffer);
+
+  output->close();
+  output->finalize();
+  output_next(simulation);
+
+  const int stride = output->stride_wait();
+  const int ip_next = ip+1;
+  if (ip_next%stride != 0 && ip_next < np) {
+    proxy_simulation[ip_next].p_output_start(index_output_);
   }
 }
 
@@ -256,18 +278,30 @@ void Problem::output_write
 
   if (output->sync_write()->next()) {
 
-    TRACE_OUTPUT("Problem::output_write(): sync_write()->next() = true");
+    if (! output->is_writer()) {
 
-    output->close();
-    output->finalize();
-    output_next(simulation);
+      // interior process of the reduction tree: all data received,
+      // so send it on toward the writer
 
-    const int stride = output->stride_wait();
-    const int ip = CkMyPe();
-    const int ip_next = ip+1;
-    const int np = CkNumPes();
-    if (ip_next%stride != 0 && ip_next < np) {
-      proxy_simulation[ip_next].p_output_start(index_output_);
+      TRACE_OUTPUT("Problem::output_write(): sending to parent");
+
+      output_send_(simulation);
+
+    } else {
+
+      TRACE_OUTPUT("Problem::output_write(): sync_write()->next() = true");
+
+      output->close();
+      output->finalize();
+      output_next(simulation);
+
+      const int stride = output->stride_wait();
+      const int ip = CkMyPe();
+      const int ip_next = ip+1;
+      const int np = CkNumPes();
+      if (ip_next%stride != 0 && ip_next < np) {
+        proxy_simulation[ip_next].p_output_start(index_output_);
+      }
     }
   } else {
     TRACE_OUTPUT("Problem::output_write(): sync_write()->next() = false");
@@ -226,6 +226,25 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 
 //----------------------------------------------------------------------
 
+void Block::p_refresh_recv_face (int id_refresh, int n, char * buffer)
+{
+  refresh_recv_face (id_refresh,n,buffer);
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_recv_face (int id_refresh, int n, char * buffer)
+{
+  MsgRefresh * msg_refresh = new MsgRefresh;
+
+  msg_refresh->set_refresh_id (id_refresh);
+  msg_refresh->load_packed (n,buffer);
+
+  p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
 void Block::refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
@@ -323,6 +342,13 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
     }
   }
+
+  // send any faces packed for neighbors on other processes
+
+  if (refresh.aggregate()) {
+    refresh_aggregate_send_();
+  }
+
   return count;
 }
 
@@ -332,30 +358,190 @@ void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
   Index index_neighbor,  int if3[3], int ic3[3])
 {
-  // create refresh message
+  performance_start_(perf_refresh_setup);
 
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
-  // create field face
+  // get field face
   if (refresh_type == refresh_coarse) {
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
   }
-  int g3[3] = {0,0,0};
-  FieldFace * field_face = create_face
-    (if3, ic3, g3, refresh_type, &refresh,false);
+  FieldFace * field_face = refresh_face_ (refresh,refresh_type,if3,ic3);
+
+  // interpolate sent values in time if subcycling
+  field_face->set_history_weight (subcycle_history_weight_());
 
   // create data message
   DataMsg * data_msg = new DataMsg;
   // initialize data message
-  data_msg -> set_field_face (field_face,true);
+  data_msg -> set_field_face (field_face,false);
   data_msg -> set_field_data (data()->field_data(),false);
 
-  // initialize refresh message
-  msg_refresh->set_refresh_id (refresh.id());
-  msg_refresh->set_data_msg (data_msg);
+  // determine the neighbor's process if aggregating remote faces
+  const int ip_neighbor = refresh.aggregate() ?
+    thisProxy.ckLocMgr()->lastKnown(CkArrayIndexIndex(index_neighbor)) :
+    CkMyPe();
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  performance_stop_(perf_refresh_setup);
+
+  if (ip_neighbor != CkMyPe()) {
+
+    // pack face into buffer for neighbor's process; sent in
+    // refresh_aggregate_send_()
+
+    performance_start_(perf_refresh_load);
+    refresh_aggregate_face_ (ip_neighbor,index_neighbor,refresh.id(),data_msg);
+    performance_stop_(perf_refresh_load);
+
+    delete data_msg;
+
+  } else {
+
+    // create refresh message
+
+    MsgRefresh * msg_refresh = new MsgRefresh;
+
+    // initialize refresh message
+    msg_refresh->set_refresh_id (refresh.id());
+    msg_refresh->set_data_msg (data_msg);
+
+    thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Number of ints in the header preceding each packed face in an
+/// aggregated refresh buffer: Index values[3], id_refresh, size, padding
+#define REFRESH_AGGREGATE_HEADER 6
+
+/// Pad packed faces to keep each header aligned
+#define REFRESH_AGGREGATE_ALIGN  8
+
+void Block::refresh_aggregate_face_
+(int ip, Index index, int id_refresh, DataMsg * data_msg)
+{
+  std::vector<char> & buffer = refresh_aggregate_[ip];
+
+  const int n = data_msg->data_size();
+  const int n_header = REFRESH_AGGREGATE_HEADER*sizeof(int);
+  const int n_padded = REFRESH_AGGREGATE_ALIGN*
+    ((n + REFRESH_AGGREGATE_ALIGN - 1) / REFRESH_AGGREGATE_ALIGN);
+
+  const size_t offset = buffer.size();
+  buffer.resize(offset + n_header + n_padded);
 
+  int header[REFRESH_AGGREGATE_HEADER] = {0};
+  index.values(header);
+  header[3] = id_refresh;
+  header[4] = n;
+  memcpy (buffer.data() + offset, header, n_header);
+
+  char * pc = data_msg->save_data(buffer.data() + offset + n_header);
+
+  ASSERT2 ("Block::refresh_aggregate_face_()",
+           "Expecting packed size %d actual size %d",
+           n,(pc - (buffer.data() + offset + n_header)),
+           (n == (pc - (buffer.data() + offset + n_header))));
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_aggregate_send_()
+{
+  // buffers are copied when sent, so are emptied but not freed to
+  // avoid reallocating them in the next refresh
+  for (auto & it : refresh_aggregate_) {
+    const int ip = it.first;
+    std::vector<char> & buffer = it.second;
+    if (buffer.size() > 0) {
+      proxy_simulation[ip].p_refresh_recv_aggregate
+        (buffer.size(),buffer.data());
+      buffer.clear();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+FieldFace * Block::refresh_face_
+(Refresh & refresh, int refresh_type, int if3[3], int ic3[3])
+{
+  // Face geometry is unchanged until neighbor levels change, so
+  // FieldFace objects (and the send regions they compute) can be
+  // reused.  Cached faces are shared with in-flight local messages,
+  // which must all have been received before the cache is cleared;
+  // this holds since the cache is only cleared after the global
+  // reduction in the adapt phase or when the Block is deleted.
+  //
+  // Faces are cached by refresh id rather than by Refresh object,
+  // since registering a Refresh may reallocate the Simulation's
+  // refresh list: the Refresh pointer is reset from the caller's on
+  // each use.
+
+  const int key = IC3(ic3) + 8*(IF3(if3) + 27*(refresh_type + 4*refresh.id()));
+
+  auto it = refresh_face_cache_.find(key);
+  if (it != refresh_face_cache_.end()) {
+    FieldFace * field_face = it->second;
+    if (field_face->refresh() != &refresh) {
+      field_face->set_refresh(&refresh,false);
+    }
+    return field_face;
+  }
+
+  int g3[3] = {0,0,0};
+  FieldFace * field_face = create_face
+    (if3, ic3, g3, refresh_type, &refresh,false);
+
+  refresh_face_cache_[key] = field_face;
+
+  return field_face;
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_face_clear_()
+{
+  for (auto & it : refresh_face_cache_) {
+    delete it.second;
+  }
+  refresh_face_cache_.clear();
+  refresh_aggregate_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_recv_aggregate (int n, char * buffer)
+{
+  const int n_header = REFRESH_AGGREGATE_HEADER*sizeof(int);
+
+  CProxy_Block proxy_block = cello::block_array();
+
+  char * pc = buffer;
+  while (pc < buffer + n) {
+
+    int header[REFRESH_AGGREGATE_HEADER];
+    memcpy (header, pc, n_header);
+
+    Index index;
+    index.set_values(header);
+    const int id_refresh = header[3];
+    const int n_face = header[4];
+    char * face = pc + n_header;
+
+    // deliver directly to the Block if it is still on this process,
+    // otherwise forward it to wherever the Block has migrated
+
+    Block * block = proxy_block[index].ckLocal();
+    if (block != nullptr) {
+      block->refresh_recv_face (id_refresh,n_face,face);
+    } else {
+      proxy_block[index].p_refresh_recv_face (id_refresh,n_face,face);
+    }
+
+    const int n_padded = REFRESH_AGGREGATE_ALIGN*
+      ((n_face + REFRESH_AGGREGATE_ALIGN - 1) / REFRESH_AGGREGATE_ALIGN);
+    pc += n_header + n_padded;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1475,7 +1661,11 @@ void Block::refresh_load_flux_face_
   FluxData * flux_data = data()->flux_data();
 
   const bool is_new = true;
-  if (refresh_type == refresh_coarse) {
+
+  // When subcycling, fluxes are only sent after the Block has taken a
+  // step, and are summed by the coarser neighbor over its step
+
+  if (refresh_type == refresh_coarse && subcycle_active()) {
     // neighbor is coarser
     const int nf = flux_data->num_fields();
     data_msg -> set_num_face_fluxes(nf);
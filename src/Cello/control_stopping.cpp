@@ -52,8 +52,13 @@ void Block::stopping_begin_()
 
   int stopping_interval = cello::config()->stopping_interval;
 
-  bool stopping_reduce = stopping_interval ? 
-    ((cycle_ % stopping_interval) == 0) : false;
+  const bool subcycle = cello::config()->stopping_subcycle;
+
+  // When subcycling, the timestep is only updated when all levels are
+  // synchronized
+
+  bool stopping_reduce = subcycle ? simulation->subcycle_sync(cycle_) :
+    (stopping_interval ? ((cycle_ % stopping_interval) == 0) : false);
 
   if (stopping_reduce || dt_==0.0) {
 
@@ -65,9 +70,13 @@ void Block::stopping_begin_()
     Method * method;
     double dt_block = std::numeric_limits<double>::max();
     while ((method = problem->method(index++))) {
-      dt_block = std::min(dt_block,method->timestep(this));
+      dt_block = std::min(dt_block,method->timestep_candidate(this));
     }
 
+    // When subcycling, reduce the equivalent level-0 timestep
+
+    if (subcycle) dt_block *= (1 << std::max(0,level()));
+
     // Reduce timestep to coincide with scheduled output if needed
 
     int index_output=0;
@@ -91,11 +100,16 @@ void Block::stopping_begin_()
 
     // Reduce to find Block array minimum dt and stopping criteria
 
-    double min_reduce[2];
+    double min_reduce[4];
 
     min_reduce[0] = dt_block;
     min_reduce[1] = stop_block ? 1.0 : 0.0;
 
+    // Finest leaf level and earliest time for subcycling
+
+    min_reduce[2] = is_leaf() ? -level() : std::numeric_limits<double>::max();
+    min_reduce[3] = time_;
+
     CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
 			 thisProxy);
 
@@ -103,7 +117,7 @@ void Block::stopping_begin_()
     CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
 	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+    contribute(4*sizeof(double), min_reduce, CkReduction::min_double, callback);
 
   } else {
 
@@ -128,17 +142,40 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   dt_   = min_reduce[0];
   stop_ = min_reduce[1] == 1.0 ? true : false;
 
+  const int    max_level = - int(min_reduce[2]);
+  const double time_min  = min_reduce[3];
+
   delete msg;
 
   Simulation * simulation = cello::simulation();
 
   dt_ *= Method::courant_global;
-  
-  set_dt   (dt_);
-  set_stop (stop_);
 
-  simulation->set_dt(dt_);
-  simulation->set_stop(stop_);
+  if (cello::config()->stopping_subcycle) {
+
+    // Start a new level-0 step: dt_ is the level-0 timestep, and each
+    // finer level takes half the timestep of its parent level.  Block
+    // times may differ by roundoff after subcycling, so they are reset
+    // to the common time.
+
+    time_ = time_min;
+    simulation->set_time (time_);
+    simulation->set_subcycle (cycle_, time_, dt_, max_level);
+
+    set_dt   (simulation->subcycle_dt(level()));
+    set_stop (stop_);
+
+    simulation->set_dt(simulation->subcycle_dt(max_level));
+    simulation->set_stop(stop_);
+
+  } else {
+
+    set_dt   (dt_);
+    set_stop (stop_);
+
+    simulation->set_dt(dt_);
+    simulation->set_stop(stop_);
+  }
 
 #ifdef CONFIG_USE_PROJECTIONS
   bool was_off = (simulation->projections_tracing() == false);
@@ -182,9 +219,16 @@ void Block::stopping_balance_()
 {
   TRACE_STOPPING("Block::stopping_balance_");
 
-  Schedule * schedule = cello::simulation()->schedule_balance();
+  Simulation * simulation = cello::simulation();
+
+  Schedule * schedule = simulation->schedule_balance();
+
+  // Blocks may only migrate when all levels are synchronized
 
-  bool do_balance = (schedule && 
+  const bool is_sync = (! cello::config()->stopping_subcycle) ||
+    simulation->subcycle_sync(cycle_);
+
+  bool do_balance = (schedule && is_sync &&
 		     schedule->write_this_cycle(cycle_,time_));
 
   if (do_balance) {
@@ -250,6 +294,38 @@ void Block::ResumeFromSync()
 
 //----------------------------------------------------------------------
 
+bool Block::subcycle_active() const
+{
+  return (! cello::config()->stopping_subcycle) ||
+    cello::simulation()->subcycle_begin(level(),cycle_);
+}
+
+//----------------------------------------------------------------------
+
+bool Block::subcycle_closing() const
+{
+  return (! cello::config()->stopping_subcycle) ||
+    cello::simulation()->subcycle_end(level(),cycle_);
+}
+
+//----------------------------------------------------------------------
+
+double Block::subcycle_history_weight_() const
+{
+  if (! cello::config()->stopping_subcycle || subcycle_active()) return 0.0;
+
+  // Blocks between steps are ahead of the current cycle time, so
+  // send values interpolated between their previous and current times
+
+  const double time_now = cello::simulation()->subcycle_time(cycle_);
+  const double time_old = time_ - dt_;
+
+  return (time_ > time_old) ?
+    std::min(1.0,std::max(0.0,(time_ - time_now) / (time_ - time_old))) : 0.0;
+}
+
+//----------------------------------------------------------------------
+
 void Block::exit_()
 {
 
@@ -269,6 +269,7 @@ char * DataMsg::load_data (char * buffer)
   // load field face
   if (n_ff > 0) {
     field_face_ = new FieldFace(cello::rank());
+    field_face_delete_ = true;
     pc = field_face_->load_data (pc);
   } else {
     field_face_ = nullptr;
@@ -374,10 +375,11 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
     }
   }
 
-  if (ff != nullptr) {
+  // field face may be owned by the sending Block's refresh face cache
+  if (ff != nullptr && field_face_delete_) {
     delete field_face_;
-    field_face_ = nullptr;
   }
+  field_face_ = nullptr;
 
   // Update fluxes
 
@@ -197,6 +197,12 @@ public: // interface
   int num_history () const
   { return field_descr_->num_history(); }
 
+  /// Whether old values of the given field are saved
+  bool has_history (int id_field) const
+  { return field_descr_->has_history(id_field); }
+  bool has_history (std::string name) const
+  { return field_descr_->has_history(field_descr_->field_id(name)); }
+
   /// Copy "current" fields to history = 1 fields (saving time), and push
   /// back older generations up to num_history()
   void save_history (double time)
@@ -259,6 +265,57 @@ public: // interface
   const char * values (std::string name, int index_history=0) const throw ()
   { return field_data_->values(field_descr_,name,index_history); }
 
+  /// Copy the field's values (including any ghosts) to the given
+  /// array, converting from the field's precision to T.  Used by
+  /// kernels computing in T on fields stored at another precision
+  template <class T>
+  void values_to (int id_field, T * array, int index_history=0) const
+  {
+    int mx,my,mz;
+    dimensions(id_field,&mx,&my,&mz);
+    const int m = mx*my*mz;
+    const char * values = this->values(id_field,index_history);
+    switch (precision(id_field)) {
+    case precision_single:
+      std::copy_n ((const float *)values, m, array);
+      break;
+    case precision_double:
+      std::copy_n ((const double *)values, m, array);
+      break;
+    case precision_quadruple:
+      std::copy_n ((const long double *)values, m, array);
+      break;
+    default:
+      ERROR1 ("Field::values_to()", "Unsupported precision %d",
+              precision(id_field));
+    }
+  }
+
+  /// Copy the given array of type T to the field's values, converting
+  /// to the field's precision
+  template <class T>
+  void values_from (int id_field, const T * array)
+  {
+    int mx,my,mz;
+    dimensions(id_field,&mx,&my,&mz);
+    const int m = mx*my*mz;
+    char * values = this->values(id_field);
+    switch (precision(id_field)) {
+    case precision_single:
+      std::copy_n (array, m, (float *)values);
+      break;
+    case precision_double:
+      std::copy_n (array, m, (double *)values);
+      break;
+    case precision_quadruple:
+      std::copy_n (array, m, (long double *)values);
+      break;
+    default:
+      ERROR1 ("Field::values_from()", "Unsupported precision %d",
+              precision(id_field));
+    }
+  }
+
   /// Return a CelloView that acts as a view of the corresponding field
   ///
   /// If the field cannot be found the program will abort with an error.
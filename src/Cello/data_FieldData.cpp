@@ -152,6 +152,8 @@ char * FieldData::values
 	(1 <= index_history && index_history <= nh)) {
       const int np = field_descr->num_permanent();
       id_field = history_id_[id_field + np*(index_history-1)];
+      // history not saved for this field
+      if (id_field < 0) return nullptr;
     }
 
     if (field_descr->is_permanent(id_field)) {
@@ -403,7 +405,9 @@ void FieldData::allocate_permanent
   for (int ih=0; ih<nh; ih++) {
     for (int ip=0; ip<np; ip++) {
       int i = ip + np*ih;
-      allocate_temporary (field_descr,history_id_[i]);
+      if (history_id_[i] >= 0) {
+        allocate_temporary (field_descr,history_id_[i]);
+      }
     }
   }
 }
@@ -928,8 +932,10 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
       history_id_[ip] = history_id_save[ip];
     }
 
-    // Copy field values to newest history
+    // Copy field values to newest history, skipping fields whose
+    // history is not saved
     for (int ip=0; ip<np; ip++) {
+      if (history_id_[ip] < 0) continue;
       int mx,my,mz;
       char * src = values(field_descr,ip,0);
       char * dst = values(field_descr,ip,1);
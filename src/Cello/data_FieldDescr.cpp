@@ -24,7 +24,8 @@ FieldDescr::FieldDescr () throw ()
     ghost_depth_(),
     conserved_(),
     history_(0),
-    history_id_()
+    history_id_(),
+    history_fields_()
 {
   for (int i=0; i<3; i++) {
     ghost_depth_default_[i] = 0;
@@ -317,6 +318,7 @@ void FieldDescr::copy_(const FieldDescr & field_descr) throw()
   for (size_t i=0; i<field_descr.history_id_.size(); i++) {
     history_id_[i] = field_descr.history_id_[i];
   }
+  history_fields_ = field_descr.history_fields_;
   
 }
 
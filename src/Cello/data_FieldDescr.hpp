@@ -77,6 +77,7 @@ public: // functions
     p | conserved_;
     p | history_;
     p | history_id_;
+    p | history_fields_;
   }
 
   /// Set alignment
@@ -124,6 +125,11 @@ public: // functions
   // History
   //----------------------------------------------------------------------
 
+  /// Restrict history to the given fields or field groups (default
+  /// all permanent fields).  Must be called before set_history()
+  void set_history_fields (const std::vector<std::string> & fields) throw()
+  { history_fields_ = fields; }
+
   /// Set the history depth for storing old field values
   void set_history (int history) throw()
   {
@@ -137,6 +143,12 @@ public: // functions
 
 	  int i = ip + np*ih;
 
+	  // no storage for fields whose history is not used
+	  if (! is_history_field_(ip)) {
+	    history_id_[i] = -1;
+	    continue;
+	  }
+
 	  const int ih = insert_temporary();
 	
 	  history_id_[i] = ih;
@@ -170,13 +182,21 @@ public: // functions
   { return history_; }
 
   /// Return the temporary field id for ih'th generation of permanent
-  /// field ip (0 is current, 1 first generation, etc.)
+  /// field ip (0 is current, 1 first generation, etc.), or -1 if the
+  /// field's history is not saved
   int history_id (int ip, int ih) const throw()
   {
     int np = num_permanent();
     return (ih == 0) ? ip : history_id_[ip + np*(ih-1)];
   }
 
+  /// Whether old values of the given field are saved
+  bool has_history (int id_field) const throw()
+  {
+    return (history_ > 0) && is_permanent(id_field) &&
+      (history_id(id_field,1) >= 0);
+  }
+
   //----------------------------------------------------------------------
   // Properties
   //----------------------------------------------------------------------
@@ -259,6 +279,17 @@ private: // functions
   int insert_(const std::string & name_field,
 	      bool is_permanent = true) throw();
 
+  /// Whether the permanent field's history is to be saved
+  bool is_history_field_ (int ip) const throw()
+  {
+    if (history_fields_.empty()) return true;
+    const std::string name = field_name(ip);
+    for (const std::string & entry : history_fields_) {
+      if (entry == name || groups_.is_in(name,entry)) return true;
+    }
+    return false;
+  }
+
 private: // attributes
 
   /// String identifying each field
@@ -306,6 +337,9 @@ private: // attributes
   /// Temporary fields used for history.  Non-permuted.
   std::vector<int> history_id_;
 
+  /// Fields or groups whose history is saved; empty for all fields
+  std::vector<std::string> history_fields_;
+
 };
 
 #endif /* DATA_FIELD_DESCR_HPP */
@@ -8,7 +8,7 @@
 #include "cello.hpp"
 #include "data.hpp"
 
-#define FORTRAN_STORE
+// #define FORTRAN_STORE
 // #define DEBUG_NEW_BOX
 // #define TRACE_FIELD_FACE
 // #define TRACE_PROLONG
@@ -126,7 +126,9 @@ FieldFace::FieldFace (int rank) throw()
   : rank_(rank),
     refresh_type_(refresh_unknown),
     refresh_(NULL),
-    new_refresh_(false)
+    new_refresh_(false),
+    box_send_(),
+    history_weight_(0.0)
 {
   ++counter[cello::index_static()]; 
   TRACE_FIELD_FACE("FieldFace(int)");
@@ -155,8 +157,9 @@ FieldFace::~FieldFace() throw ()
 FieldFace::FieldFace(const FieldFace & field_face) throw ()
   :  refresh_type_(refresh_unknown),
      refresh_(NULL),
-     new_refresh_(false)
-
+     new_refresh_(false),
+     box_send_(),
+     history_weight_(0.0)
 {
   ++counter[cello::index_static()];
   TRACE_FIELD_FACE("FieldFace(FieldFace)");
@@ -186,6 +189,8 @@ void FieldFace::copy_(const FieldFace & field_face)
   }
   refresh_type_   = field_face.refresh_type_;
   refresh_        = field_face.refresh_;
+  box_send_       = field_face.box_send_;
+  history_weight_ = field_face.history_weight_;
   // new_refresh_ must not be true in more than one FieldFace to avoid
   // multiple deletes
   new_refresh_  = false;
@@ -248,34 +253,18 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     char * array_face  = &array[index_array];
 
-    int m3[3],g3[3],c3[3];
+    int m3[3];
 
     field.dimensions (index_field,m3,m3+1,m3+2);
-    field.ghost_depth(index_field,g3,g3+1,g3+2);
-    field.centering  (index_field,c3,c3+1,c3+2);
 
     const bool accumulate = refresh_->accumulate(i_f);
 
     int i3[3], n3[3];
-    field.size(n3,n3+1,n3+2);
-    Box box(rank_,n3,g3);
-    box.set_centering(c3);
-    set_box_(&box);
+    send_region_(field,i_f,index_field,field_list_src.size(),i3,n3);
 
-    box_adjust_accumulate_(&box,accumulate,g3);
-
-    box.compute_region();
-    // limits for Send block 
-    //    box.get_start_size(i3,n3,BlockType::receive,BlockType::send);
-    bool lpad;
-    TRACE_ONCE;
-    box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
-#ifdef DEBUG_NEW_BOX
-    if (i_f == 0) {
-      CkPrintf ("DEBUG_NEW_BOX face_to_array() %d %d %d\n",i3[0],i3[1],i3[2]);
-      CkPrintf ("DEBUG_NEW_BOX face_to_array() %d %d %d\n",n3[0],n3[1],n3[2]);
-    }
-#endif
+    // interpolate in time if needed
+    std::vector<char> saved[2];
+    blend_history_(field,index_field,i3,n3,m3,saved);
 
     // scale by density if needed to convert to conservative form
     mul_by_density_(field,index_field,i3,n3,m3);
@@ -315,6 +304,8 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     // unscale by density if needed to convert back from conservative form
     div_by_density_(field,index_field,i3,n3,m3);
+
+    restore_history_(field,index_field,i3,n3,m3,saved);
   }
 
 }
@@ -491,6 +482,10 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
     char * values_src = field_src.values(index_src);
     char * values_dst = field_dst.values(index_dst);
 
+    // interpolate in time if needed
+    std::vector<char> saved[2];
+    blend_history_(field_src,index_src,is3,ns3,m3,saved);
+
     // scale by density if needed to convert to conservative form
     mul_by_density_(field_src,index_src,is3,ns3,m3);
     
@@ -556,6 +551,8 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
     // unscale by density if needed to convert back from conservative form
     div_by_density_(field_src,index_src,is3,ns3,m3);
     div_by_density_(field_dst,index_dst,id3,nd3,m3);
+
+    restore_history_(field_src,index_src,is3,ns3,m3,saved);
   }
 #ifdef CONFIG_SMP_MODE
   CmiUnlock(field_face_node_lock);
@@ -580,42 +577,90 @@ int FieldFace::num_bytes_array(Field field) throw()
     precision_type precision = field.precision(index_field);
     int bytes_per_element = cello::sizeof_precision (precision);
 
-    int m3[3],n3[3],g3[3],c3[3];
+    int i3[3],n3[3];
+    send_region_(field,i_f,index_field,field_list_src.size(),i3,n3);
+
+    array_size += n3[0]*n3[1]*n3[2]*bytes_per_element;
+
+  }
+
+  ASSERT("FieldFace::num_bytes_array()",
+	 "array_size must be > 0, maybe field_list.size() is 0?",
+	 array_size);
+
+  return array_size;
+
+}
+
+//----------------------------------------------------------------------
+
+void FieldFace::array_size (Field field, int i_f, int n3[3])
+{
+  auto field_list_src = refresh_->field_list_src();
+
+  int i3[3];
+  send_region_(field,i_f,field_list_src[i_f],field_list_src.size(),i3,n3);
+}
+
+//----------------------------------------------------------------------
+
+void FieldFace::send_region_
+(Field field, int i_f, int index_field, int n_f, int i3[3], int n3[3])
+{
+  // (re)initialize cache if the field list has changed; a cached
+  // region is reused only if it was computed for the same field and
+  // accumulate flag, so changes to the Refresh field list are detected
+
+  if (box_send_.size() != size_t(8*n_f)) {
+    box_send_.assign(8*n_f,-1);
+  }
+
+  int * box_send = &box_send_[8*i_f];
+
+  const int accumulate = refresh_->accumulate(i_f) ? 1 : 0;
+
+  if (box_send[0] != index_field || box_send[1] != accumulate) {
+
+    int g3[3],c3[3];
 
-    field.dimensions (index_field,m3,m3+1,m3+2);
     field.size                   (n3,n3+1,n3+2);
     field.ghost_depth(index_field,g3,g3+1,g3+2);
     field.centering  (index_field,c3,c3+1,c3+2);
 
-    const bool accumulate = refresh_->accumulate(i_f);
-
     Box box (rank_,n3,g3);
     set_box_(&box);
     box.set_centering(c3);
 
     box_adjust_accumulate_(&box,accumulate,g3);
 
+    box.compute_region();
+
+    // limits for Send block
     bool lpad;
-    int i3[3];
     TRACE_ONCE;
     box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
-    
+
 #ifdef DEBUG_NEW_BOX
     if (i_f == 0) {
-      CkPrintf ("DEBUG_NEW_BOX num_bytes_array() %d %d %d\n",i3[0],i3[1],i3[2]);
-      CkPrintf ("DEBUG_NEW_BOX num_bytes_array() %d %d %d\n",n3[0],n3[1],n3[2]);
+      CkPrintf ("DEBUG_NEW_BOX send_region_() %d %d %d\n",i3[0],i3[1],i3[2]);
+      CkPrintf ("DEBUG_NEW_BOX send_region_() %d %d %d\n",n3[0],n3[1],n3[2]);
     }
 #endif
-    array_size += n3[0]*n3[1]*n3[2]*bytes_per_element;
-
-  }
 
-  ASSERT("FieldFace::num_bytes_array()",
-	 "array_size must be > 0, maybe field_list.size() is 0?",
-	 array_size);
+    box_send[0] = index_field;
+    box_send[1] = accumulate;
+    for (int i=0; i<3; i++) {
+      box_send[i+2] = i3[i];
+      box_send[i+5] = n3[i];
+    }
 
-  return array_size;
+  } else {
 
+    for (int i=0; i<3; i++) {
+      i3[i] = box_send[i+2];
+      n3[i] = box_send[i+5];
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -688,6 +733,96 @@ char * FieldFace::load_data (char * buffer)
 
 //======================================================================
 
+/// Copy (or add if ACCUMULATE) an n3[0] x n3[1] x n3[2] region of
+/// src with x and y strides msx,msy into dst with strides mdx,mdy.
+/// NX > 0 specializes for rows of exactly NX values; NX == 0 handles
+/// rows of any length
+template<class T, bool ACCUMULATE, int NX>
+static void field_face_rows_
+(T * dst, int mdx, int mdy, const T * src, int msx, int msy,
+ const int n3[3]) throw()
+{
+  const int nx = (NX > 0) ? NX : n3[0];
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      T       * d = dst + mdx*(iy + mdy*iz);
+      const T * s = src + msx*(iy + msy*iz);
+      if constexpr (ACCUMULATE) {
+#pragma omp simd
+        for (int ix=0; ix<nx; ix++) d[ix] += s[ix];
+      } else if constexpr (NX > 0) {
+        for (int ix=0; ix<NX; ix++) d[ix] = s[ix];
+      } else {
+        memcpy (d,s,nx*sizeof(T));
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Select the field_face_rows_() kernel for the accumulate mode and
+/// row length
+template<class T, bool ACCUMULATE>
+static void field_face_rows_
+(T * dst, int mdx, int mdy, const T * src, int msx, int msy,
+ const int n3[3]) throw()
+{
+  switch (n3[0]) {
+  case 1:
+    field_face_rows_<T,ACCUMULATE,1> (dst,mdx,mdy,src,msx,msy,n3); break;
+  case 2:
+    field_face_rows_<T,ACCUMULATE,2> (dst,mdx,mdy,src,msx,msy,n3); break;
+  case 3:
+    field_face_rows_<T,ACCUMULATE,3> (dst,mdx,mdy,src,msx,msy,n3); break;
+  case 4:
+    field_face_rows_<T,ACCUMULATE,4> (dst,mdx,mdy,src,msx,msy,n3); break;
+  default:
+    field_face_rows_<T,ACCUMULATE,0> (dst,mdx,mdy,src,msx,msy,n3); break;
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Copy (or add) the region of size n3 from src with dimensions ms3
+/// to dst with dimensions md3.  Rows that are contiguous in both
+/// arrays are merged so that full-width regions are copied as a
+/// single run.
+template<class T>
+static void field_face_region_
+(T * dst, const int md3[3], const T * src, const int ms3[3],
+ const int n3[3], bool accumulate) throw()
+{
+  int n[3] = {n3[0],n3[1],n3[2]};
+  int mdx = md3[0], mdy = md3[1];
+  int msx = ms3[0], msy = ms3[1];
+
+  if (n[0] == md3[0] && n[0] == ms3[0]) {
+    if (n[1] == md3[1] && n[1] == ms3[1]) {
+      // whole region is contiguous
+      n[0] *= n[1]*n[2];
+      n[1] = 1;
+      n[2] = 1;
+    } else {
+      // each xy-plane is contiguous
+      n[0] *= n[1];
+      n[1] = 1;
+      mdx *= mdy;
+      msx *= msy;
+      mdy = 1;
+      msy = 1;
+    }
+  }
+
+  if (accumulate) {
+    field_face_rows_<T,true> (dst,mdx,mdy,src,msx,msy,n);
+  } else {
+    field_face_rows_<T,false>(dst,mdx,mdy,src,msx,msy,n);
+  }
+}
+
+//----------------------------------------------------------------------
+
 template<class T>
 size_t FieldFace::load_
 ( T * array_face, const T * field_face, 
@@ -697,18 +832,9 @@ size_t FieldFace::load_
   // is handled in corresponding store_() at the receiving end
   // add values
 
-  for (int iz=0; iz <n3[2]; iz++)  {
-    int kz = iz+i3[2];
-    for (int iy=0; iy < n3[1]; iy++) {
-      int ky = iy+i3[1];
-      for (int ix=0; ix < n3[0]; ix++) {
-	int kx = ix+i3[0];
-	int index_array = ix +   n3[0]*(iy +   n3[1] * iz);
-	int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	array_face[index_array] = field_face[index_field];
-      }
-    }
-  }
+  const int im = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
+
+  field_face_region_ (array_face, n3, field_face + im, m3, n3, false);
 
   return (sizeof(T) * n3[0] * n3[1] * n3[2]);
 
@@ -766,35 +892,8 @@ template<class T> size_t FieldFace::store_
     }
   } else {
 
-    if (accumulate) {
-      // add values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] += array[index_array];
-          }
-        }
-      }
-    } else {
-      // copy values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] = array[index_array];
-          }
-        }
-      }
-    }
+    field_face_region_ (ghost + im, m3, array, n3, n3, accumulate);
+
   }
 
   return (sizeof(T) * n3[0] * n3[1] * n3[2]);
@@ -810,33 +909,8 @@ template<class T> void FieldFace::copy_
 {
   const int is0 = is3[0] + ms3[0]*(is3[1] + ms3[1]*is3[2]);
   const int id0 = id3[0] + md3[0]*(id3[1] + md3[1]*id3[2]);
-  T * vd0 = vd + id0;
-  const T * vs0 = vs + is0;
-  const int msx = ms3[0];
-  const int msy = ms3[1];
-  const int mdx = md3[0];
-  const int mdy = md3[1];
-  if (accumulate) {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] += vs0[i_src];
-	}
-      }
-    }
-  } else {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] = vs0[i_src];
-	}
-      }
-    }
-  }
+
+  field_face_region_ (vd + id0, md3, vs + is0, ms3, ns3, accumulate);
 }
 
 //----------------------------------------------------------------------
@@ -979,6 +1053,111 @@ void FieldFace::div_by_density_
 
 //----------------------------------------------------------------------
 
+void FieldFace::blend_history_
+(Field field, int index_field,
+ const int i3[3], const int n3[3], const int m3[3],
+ std::vector<char> saved[2])
+{
+  if (history_weight_ == 0.0 || ! field.is_permanent(index_field)) return;
+
+  // blend density as well if the field is scaled by density
+
+  const int index_density = field.field_id("density");
+  const bool scale_by_density =
+    (refresh_type_ != refresh_same) && (index_density >= 0) &&
+    (index_density != index_field) &&
+    cello::field_groups()->is_in
+    (field.field_name(index_field),"make_field_conservative");
+
+  const int ids[2] = { index_field, scale_by_density ? index_density : -1 };
+
+  for (int k=0; k<2; k++) {
+    const int id = ids[k];
+
+    // fields without history (see "Field:history_fields") are sent
+    // unchanged; saved[k] stays empty so they are not restored
+    if (id < 0 || ! field.has_history(id)) continue;
+
+    const precision_type precision = field.precision(id);
+    saved[k].resize(n3[0]*n3[1]*n3[2]*cello::sizeof_precision(precision));
+
+    union { float * f4; double * f8; long double * f16; };
+    union { float * h4; double * h8; long double * h16; };
+    union { float * s4; double * s8; long double * s16; };
+    f4 = (float *) field.values(id);
+    h4 = (float *) field.values(id,1);
+    s4 = (float *) saved[k].data();
+
+    if (precision == precision_single) {
+      blend_ (f4, h4, s4, i3,n3,m3, history_weight_);
+    } else if (precision == precision_double) {
+      blend_ (f8, h8, s8, i3,n3,m3, history_weight_);
+    } else if (precision == precision_quadruple) {
+      blend_ (f16,h16,s16,i3,n3,m3, history_weight_);
+    } else {
+      ERROR("FieldFace::blend_history_()", "Unsupported precision");
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldFace::restore_history_
+(Field field, int index_field,
+ const int i3[3], const int n3[3], const int m3[3],
+ std::vector<char> saved[2])
+{
+  for (int k=0; k<2; k++) {
+    if (saved[k].empty()) continue;
+
+    const int id = (k == 0) ? index_field : field.field_id("density");
+    const precision_type precision = field.precision(id);
+
+    union { float * f4; double * f8; long double * f16; };
+    union { float * s4; double * s8; long double * s16; };
+    f4 = (float *) field.values(id);
+    s4 = (float *) saved[k].data();
+
+    if (precision == precision_single) {
+      blend_ (f4, (float *)nullptr,      s4, i3,n3,m3, 0.0);
+    } else if (precision == precision_double) {
+      blend_ (f8, (double *)nullptr,     s8, i3,n3,m3, 0.0);
+    } else if (precision == precision_quadruple) {
+      blend_ (f16,(long double *)nullptr,s16,i3,n3,m3, 0.0);
+    } else {
+      ERROR("FieldFace::restore_history_()", "Unsupported precision");
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template<class T>
+void FieldFace::blend_
+(T * values, const T * history, T * saved,
+ const int i3[3], const int n3[3], const int m3[3],
+ double weight) throw()
+{
+  const T w1 = weight;
+  const T w0 = 1.0 - weight;
+  int k = 0;
+  for (int iz=i3[2]; iz<i3[2]+n3[2]; iz++) {
+    for (int iy=i3[1]; iy<i3[1]+n3[1]; iy++) {
+      for (int ix=i3[0]; ix<i3[0]+n3[0]; ix++, k++) {
+        const int i=ix + m3[0]*(iy + m3[1]*iz);
+        if (history) {
+          saved[k] = values[i];
+          values[i] = w0*values[i] + w1*history[i];
+        } else {
+          values[i] = saved[k];
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void FieldFace::set_box_(Box * box)
 {
   const int level =
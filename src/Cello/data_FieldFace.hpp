@@ -45,6 +45,7 @@ public: // interface
     ghost_[0] = gx;
     ghost_[1] = gy;
     ghost_[2] = gz;
+    box_send_.clear();
   }
 
   void ghost (int *gx, int *gy, int *gz)
@@ -59,6 +60,7 @@ public: // interface
     face_[0] = fx;
     face_[1] = fy;
     face_[2] = fz;
+    box_send_.clear();
   }
   
   /// Set the face
@@ -74,6 +76,7 @@ public: // interface
     face_[0] = -face_[0];
     face_[1] = -face_[1];
     face_[2] = -face_[2];
+    box_send_.clear();
   }
   /// Set child if restrict or prolong is required
   void set_child(int icx, int icy=0, int icz=0) throw()
@@ -81,13 +84,17 @@ public: // interface
     child_[0] = icx;
     child_[1] = icy;
     child_[2] = icz;
+    box_send_.clear();
   }
 
   /// Set refresh type: refresh_fine(prolong),
   /// refresh_coarse(restrict), or refresh_same(copy)
 
   void set_refresh_type (int refresh_type)
-  {  refresh_type_ = refresh_type;  }
+  {
+    refresh_type_ = refresh_type;
+    box_send_.clear();
+  }
 
   Prolong * prolong ()
   { return refresh_->prolong(); }
@@ -100,11 +107,22 @@ public: // interface
   {
     refresh_ = refresh;
     new_refresh_ = new_refresh;
+    box_send_.clear();
   }
 
   /// Return the Refresh object
   Refresh * refresh () const
   { return refresh_; }
+
+  /// Set the weight of the field history (index 1) when loading face
+  /// values: 0.0 loads current values, 1.0 loads history values, and
+  /// values in between interpolate linearly in time
+  void set_history_weight (double weight)
+  { history_weight_ = weight; }
+
+  /// Return the weight of the field history when loading face values
+  double history_weight () const
+  { return history_weight_; }
   
   void set_field_list (std::vector<int> field_list);
   
@@ -125,6 +143,10 @@ public: // interface
 
   int num_bytes_array (Field field) throw();
 
+  /// Return the size of the i_f'th source field's region in arrays
+  /// created by face_to_array()
+  void array_size (Field field, int i_f, int n3[3]);
+
   //--------------------------------------------------
 
   /// Return the number of bytes required to serialize the data object
@@ -184,6 +206,34 @@ private: // functions
   (Field field, int index_field,
    const int i3[3], const int n3[3], const int m3[3]);
 
+  /// Interpolate the given region of a field, and of density if the
+  /// field is scaled by density, in time toward its history values
+  /// using history_weight_.  Current values are saved in saved[0]
+  /// and saved[1] for restore_history_()
+  void blend_history_
+  (Field field, int index_field,
+   const int i3[3], const int n3[3], const int m3[3],
+   std::vector<char> saved[2]);
+
+  /// Restore field values saved by blend_history_()
+  void restore_history_
+  (Field field, int index_field,
+   const int i3[3], const int n3[3], const int m3[3],
+   std::vector<char> saved[2]);
+
+  /// Precision-agnostic function for blending or restoring field
+  /// values in a region: if history is not null then the region is
+  /// saved and blended, otherwise it is restored from saved
+  template<class T>
+  void blend_ (T * values, const T * history, T * saved,
+               const int i3[3], const int n3[3], const int m3[3],
+               double weight) throw();
+
+  /// Return the start and size of the send region for the i_f'th of
+  /// n_f source fields, computing it on first use
+  void send_region_
+  (Field field, int i_f, int index_field, int n_f, int i3[3], int n3[3]);
+
   /// Initialize the associated Box object box_ using current attributes
   void set_box_(Box * box);
 
@@ -213,6 +263,16 @@ private: // attributes
 
   /// Whether refresh object should be deleted in destructor
   bool new_refresh_;
+
+  /// Field index, accumulate flag, and start and size of the send
+  /// region for each field in the Refresh source field list (8 ints
+  /// per field), computed by face_to_array() and reused while the
+  /// face geometry and field are unchanged
+  std::vector<int> box_send_;
+
+  /// Weight of history field values for interpolating face values
+  /// in time; not serialized since faces are loaded by the sender
+  double history_weight_;
 };
 
 #endif /* DATA_FIELD_FACE_HPP */
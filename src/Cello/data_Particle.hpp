@@ -350,6 +350,16 @@ public: // interface
   void compress (int it)
   { particle_data_->compress(particle_descr_,it); }
 
+  /// Reorder particles of the given type by the Morton index of their
+  /// cell in the box [lower,upper) divided into n3 cells, so that
+  /// particles in the same cell are contiguous.  Sorting an already
+  /// mostly sorted type only sorts and merges the out-of-order tail.
+  /// Returns the number of particles that were out of order.
+
+  int sort (int it, const double lower[3], const double upper[3],
+            const int n3[3])
+  { return particle_data_->sort(particle_descr_,it,lower,upper,n3); }
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -585,6 +585,112 @@ void ParticleData::compress (ParticleDescr * particle_descr, int it)
 }
 
 
+//----------------------------------------------------------------------
+
+namespace {
+  /// Spread the lower 21 bits of i so that bit k moves to bit 3k
+  inline uint64_t spread_bits_ (uint64_t i)
+  {
+    i &= 0x1fffff;
+    i = (i | (i << 32)) & 0x001f00000000ffffull;
+    i = (i | (i << 16)) & 0x001f0000ff0000ffull;
+    i = (i | (i <<  8)) & 0x100f00f00f00f00full;
+    i = (i | (i <<  4)) & 0x10c30c30c30c30c3ull;
+    i = (i | (i <<  2)) & 0x1249249249249249ull;
+    return i;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int ParticleData::sort
+(ParticleDescr * particle_descr, int it,
+ const double lower[3], const double upper[3], const int n3[3])
+{
+  check_arrays_(particle_descr,__FILE__,__LINE__);
+
+  const int nb = num_batches(it);
+  const int mb = particle_descr->batch_size();
+
+  // global index of the first particle in each batch
+
+  std::vector<int> offset(nb+1,0);
+  for (int ib=0; ib<nb; ib++) {
+    offset[ib+1] = offset[ib] + num_particles(particle_descr,it,ib);
+  }
+  const int np = offset[nb];
+
+  if (np <= 1) return 0;
+
+  // compute the Morton key of each particle's cell; axes without a
+  // position attribute keep the lower coordinate
+
+  std::vector<uint64_t> key(np);
+  std::vector<double> x3[3];
+  for (int axis=0; axis<3; axis++) x3[axis].assign(mb,lower[axis]);
+
+  for (int ib=0; ib<nb; ib++) {
+    position(particle_descr,it,ib,x3[0].data(),x3[1].data(),x3[2].data());
+    const int np_batch = offset[ib+1] - offset[ib];
+    for (int ip=0; ip<np_batch; ip++) {
+      uint64_t k = 0;
+      for (int axis=0; axis<3; axis++) {
+        const int n = n3[axis];
+        const double t = n*(x3[axis][ip]-lower[axis])/(upper[axis]-lower[axis]);
+        const int i = std::max(0,std::min(n-1,int(std::floor(t))));
+        k |= spread_bits_(i) << axis;
+      }
+      key[offset[ib]+ip] = k;
+    }
+  }
+
+  // length of the already sorted prefix
+
+  int ns = 1;
+  while (ns < np && key[ns-1] <= key[ns]) ++ns;
+
+  if (ns == np) return 0;
+
+  // sort the tail and merge it with the prefix; both are stable so
+  // particles in the same cell keep their relative order
+
+  std::vector<int> order(np);
+  for (int i=0; i<np; i++) order[i] = i;
+  auto key_less = [&key] (int i, int j) { return key[i] < key[j]; };
+  std::stable_sort (order.begin()+ns, order.end(), key_less);
+  std::inplace_merge (order.begin(), order.begin()+ns, order.end(), key_less);
+
+  // permute each attribute through a contiguous buffer
+
+  const bool interleaved = particle_descr->interleaved(it);
+  const int na = particle_descr->num_attributes(it);
+  int mp = particle_descr->particle_bytes(it);
+
+  std::vector<char> buffer;
+  for (int ia=0; ia<na; ia++) {
+    if (!interleaved) {
+      mp = particle_descr->attribute_bytes(it,ia);
+    }
+    const int ny = particle_descr->attribute_bytes(it,ia);
+    buffer.resize((size_t)np*ny);
+    for (int ib=0; ib<nb; ib++) {
+      const char * a = attribute_array(particle_descr,it,ia,ib);
+      for (int ip=0; ip<offset[ib+1]-offset[ib]; ip++) {
+        std::copy_n (a + mp*ip, ny, &buffer[(size_t)ny*(offset[ib]+ip)]);
+      }
+    }
+    for (int ib=0; ib<nb; ib++) {
+      char * a = attribute_array(particle_descr,it,ia,ib);
+      for (int ip=0; ip<offset[ib+1]-offset[ib]; ip++) {
+        const int i_src = order[offset[ib]+ip];
+        std::copy_n (&buffer[(size_t)ny*i_src], ny, a + mp*ip);
+      }
+    }
+  }
+
+  return np - ns;
+}
+
 //----------------------------------------------------------------------
 
 float ParticleData::efficiency (ParticleDescr * particle_descr)
@@ -106,6 +106,18 @@ public: // interface
   void compress (ParticleDescr *);
   void compress (ParticleDescr *, int it);
 
+  /// Reorder particles of the given type across batches by the Morton
+  /// (Z-order) index of the cell containing them, where cells are
+  /// given by dividing the box [lower,upper) into n3 cells.  Batch
+  /// sizes are unchanged.  Deleting particles preserves the order, and
+  /// particles added by insert_particles() or gather() are appended,
+  /// so for a previously sorted type only the trailing out-of-order
+  /// particles are sorted and then merged.  Returns the number of
+  /// particles that were out of order.
+
+  int sort (ParticleDescr *, int it,
+            const double lower[3], const double upper[3], const int n3[3]);
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -38,7 +38,13 @@ FileHdf5::FileHdf5 (std::string path, std::string name) throw()
     data_rank_(0),
     data_prop_(H5P_DEFAULT),
     is_data_open_(false),
-    compress_level_(0)
+    compress_level_(0),
+    shuffle_(true),
+    chunk_size_(0),
+    truncate_bits_(0),
+    bytes_written_(0),
+    time_write_(0.0),
+    is_data_written_(false)
 {
   data_prop_  = H5Pcreate (H5P_DATASET_CREATE);
 #ifdef TRACE_DISK  
@@ -261,13 +267,17 @@ void FileHdf5::data_create
 
   // Create the new dataset
 
+  hid_t data_prop = create_data_prop_(data_space_id_);
+
   data_id_ = H5Dcreate( group,
 			name.c_str(),
 			scalar_to_hdf5_(type),
 			data_space_id_,
 			H5P_DEFAULT,
-			data_prop_,
+			data_prop,
 			H5P_DEFAULT);
+
+  if (data_prop != data_prop_) H5Pclose (data_prop);
 #ifdef TRACE_DISK  
   CkPrintf ("%d %Ld :%d TRACE_DISK H5Dcreate(%d)\n",CkMyPe(),file_id_, __LINE__,data_id_);
   fflush(stdout);
@@ -347,6 +357,29 @@ void FileHdf5::data_write ( const void * buffer ) throw()
   CkPrintf ("%d %Ld :%d TRACE_DISK H5Dwrite(%d)\n",CkMyPe(),file_id_, __LINE__,data_id_);
   fflush(stdout);
 #endif  
+  // Round away low mantissa bits if requested, in a copy of the
+  // memory buffer
+
+  std::vector<char> truncated;
+  if (truncate_bits_ > 0 &&
+      (data_type_ == type_float || data_type_ == type_double)) {
+    const hid_t space_id =
+      (mem_space_id_ == H5S_ALL) ? data_space_id_ : mem_space_id_;
+    const size_t n = H5Sget_simple_extent_npoints(space_id);
+    if (data_type_ == type_float) {
+      truncated.assign((const char *)buffer,
+                       (const char *)buffer + n*sizeof(float));
+      truncate_<float,uint32_t>(truncated.data(),n,23);
+    } else {
+      truncated.assign((const char *)buffer,
+                       (const char *)buffer + n*sizeof(double));
+      truncate_<double,uint64_t>(truncated.data(),n,52);
+    }
+    buffer = truncated.data();
+  }
+
+  const auto time_begin = std::chrono::steady_clock::now();
+
   int retval = 
     H5Dwrite (data_id_,
 	      scalar_to_hdf5_(data_type_),
@@ -355,6 +388,11 @@ void FileHdf5::data_write ( const void * buffer ) throw()
 	      H5P_DEFAULT,
 	      buffer);
 
+  time_write_ += std::chrono::duration<double>
+    (std::chrono::steady_clock::now() - time_begin).count();
+
+  is_data_written_ = true;
+
   // error check H5Dread
 
   ASSERT1("FileHdf5::data_write","H5Dwrite() returned %d",retval,(retval>=0));
@@ -372,13 +410,25 @@ void FileHdf5::data_close() throw()
     space_close_(data_space_id_);
     //     space_close_(mem_space_id_);
 
-    // close the dataset
+    // close the dataset, including the time to flush filtered chunks
+
+    if (is_data_written_) {
+      bytes_written_ += H5Dget_storage_size (data_id_);
+    }
+
+    const auto time_begin = std::chrono::steady_clock::now();
 
     close_dataset_ ();
 
+    if (is_data_written_) {
+      time_write_ += std::chrono::duration<double>
+        (std::chrono::steady_clock::now() - time_begin).count();
+    }
+
     // update dataset state
 
     is_data_open_ = false;
+    is_data_written_ = false;
   }
 }
 
@@ -789,17 +839,11 @@ void FileHdf5::group_read_meta
 
 void FileHdf5::set_compress (int level) throw ()
 {
+  ASSERT1("FileHdf5::set_compress",
+          "Compression level %d must be between 0 and 9",
+          level, (0 <= level && level <= 9));
+
   compress_level_ = level; 
-  if (compress_level_ != 0) {
-    WARNING("FileHdf5::set_compress",
-	    "Hard-coded for 2D data with chunk size [10,10]");
-    int rank = 2;
-    hsize_t chunk_size[MAX_DATA_RANK];
-    chunk_size[0]=10;
-    chunk_size[1]=10;
-    H5Pset_chunk(data_prop_,rank,chunk_size);
-    H5Pset_deflate(data_prop_,compress_level_);
-  }
 }
 
 //======================================================================
@@ -1286,6 +1330,60 @@ void FileHdf5::close_dataset_ () throw()
 
 //----------------------------------------------------------------------
 
+hdf5_id FileHdf5::create_data_prop_ (hdf5_id space_id) throw()
+{
+  if (compress_level_ == 0) return data_prop_;
+
+  const int rank = H5Sget_simple_extent_ndims(space_id);
+  hsize_t dims[MAX_DATA_RANK];
+  H5Sget_simple_extent_dims(space_id,dims,0);
+
+  // chunks must be non-empty, so store empty datasets contiguously
+
+  hsize_t chunk_size[MAX_DATA_RANK];
+  for (int i=0; i<rank; i++) {
+    if (dims[i] == 0) return data_prop_;
+    chunk_size[i] = dims[i];
+    if (chunk_size_ > 0) {
+      chunk_size[i] = std::min(chunk_size[i],hsize_t(chunk_size_));
+    }
+  }
+
+  hid_t data_prop = H5Pcopy (data_prop_);
+  H5Pset_chunk(data_prop,rank,chunk_size);
+  if (shuffle_) H5Pset_shuffle(data_prop);
+  H5Pset_deflate(data_prop,compress_level_);
+
+  return data_prop;
+}
+
+//----------------------------------------------------------------------
+
+template <class T, class U>
+void FileHdf5::truncate_ (void * values, size_t n, int mantissa_bits) const throw()
+{
+  static_assert(sizeof(T) == sizeof(U),
+                "FileHdf5::truncate_() requires types of the same size");
+
+  const int bits = std::min(truncate_bits_,mantissa_bits);
+  const U mask = ~((U(1) << bits) - 1);
+  const U half = U(1) << (bits - 1);
+
+  for (size_t i=0; i<n; i++) {
+    T value;
+    U u;
+    std::memcpy(&value,(char *)values + i*sizeof(T),sizeof(T));
+    // leave infinities and NaNs unchanged
+    if (! std::isfinite(value)) continue;
+    std::memcpy(&u,&value,sizeof(T));
+    // round to nearest, with carries propagating into the exponent
+    u = (u + half) & mask;
+    std::memcpy((char *)values + i*sizeof(T),&u,sizeof(T));
+  }
+}
+
+//----------------------------------------------------------------------
+
 hdf5_id FileHdf5::get_data_space_(hdf5_id data_id, std::string name) throw ()
 {
 
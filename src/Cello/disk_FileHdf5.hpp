@@ -55,6 +55,12 @@ public: // interface
     p | data_prop_;
     p | is_data_open_;
     p | compress_level_;
+    p | shuffle_;
+    p | chunk_size_;
+    p | truncate_bits_;
+    p | bytes_written_;
+    p | time_write_;
+    p | is_data_written_;
   }
 
 public: // virtual functions
@@ -171,12 +177,35 @@ public: // virtual functions
 
 public: // functions
 
-  /// Set the compression level
+  /// Set the deflate compression level (0 to 9) of datasets created
+  /// afterwards; 0 writes contiguous uncompressed datasets
   void set_compress (int level) throw ();
 
   /// Return the compression level
   int compress () throw () {return compress_level_; }
 
+  /// Set whether to apply the shuffle filter before compression
+  void set_shuffle (bool shuffle) throw ()
+  { shuffle_ = shuffle; }
+
+  /// Set the maximum chunk extent along each axis of compressed
+  /// datasets; 0 stores each dataset as a single chunk
+  void set_chunk_size (int chunk_size) throw ()
+  { chunk_size_ = chunk_size; }
+
+  /// Set the number of low-order mantissa bits of floating-point data
+  /// to round away before writing (lossy); 0 writes data unchanged
+  void set_truncate_bits (int truncate_bits) throw ()
+  { truncate_bits_ = truncate_bits; }
+
+  /// Return the number of bytes stored by datasets closed so far
+  long long bytes_written () const throw ()
+  { return bytes_written_; }
+
+  /// Return the time in seconds spent writing and closing datasets
+  double time_write () const throw ()
+  { return time_write_; }
+
   /// Allocate a buffer for reading in a dataset of the given
   /// length and type
   char * allocate_buffer (int n, int type_data)
@@ -257,6 +286,15 @@ private: // functions
   /// Close the dataset
   void close_dataset_ () throw();
 
+  /// Create the dataset creation property list for the given
+  /// dataspace, enabling chunking and filters if compressing
+  hdf5_id create_data_prop_ (hdf5_id space_id) throw();
+
+  /// Round away the low truncate_bits_ mantissa bits of n values of
+  /// type T, stored as unsigned integers of type U of the same size
+  template <class T, class U>
+  void truncate_ (void * values, size_t n, int mantissa_bits) const throw();
+
 public: // static attributes
 
   /// Nodal list of files opened
@@ -315,6 +353,24 @@ private: // attributes
   /// Compression level
   int compress_level_;
 
+  /// Whether to apply the shuffle filter to compressed datasets
+  bool shuffle_;
+
+  /// Maximum chunk extent along each axis, or 0 for the dataset size
+  int chunk_size_;
+
+  /// Number of mantissa bits to round away when writing floating-point
+  int truncate_bits_;
+
+  /// Bytes stored by datasets closed so far
+  long long bytes_written_;
+
+  /// Seconds spent in H5Dwrite() and H5Dclose()
+  double time_write_;
+
+  /// Whether the open dataset has been written to
+  bool is_data_written_;
+
 };
 
 #endif /* DISK_FILE_HDF5_HPP */
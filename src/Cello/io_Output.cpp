@@ -31,7 +31,8 @@ Output::Output (int index, const Factory * factory) throw()
     it_field_index_(nullptr),        // set_it_index_field()
     it_particle_index_(nullptr),        // set_it_index_particle()
     stride_write_(1), // default one file per process
-    stride_wait_(1) // default all can write at once
+    stride_wait_(1), // default all can write at once
+    reduce_arity_(0) // default all processes send to the writer
 
 {
   io_block_         = factory->create_io_block();
@@ -84,11 +85,44 @@ void Output::pup (PUP::er &p)
 
   p | stride_write_;
   p | stride_wait_;
+  p | reduce_arity_;
 
 }
 
 //----------------------------------------------------------------------
 
+int Output::process_parent() const throw()
+{
+  const int ip = CkMyPe();
+  const int ip_write = process_writer();
+  const int rank = ip - ip_write;
+
+  if (rank == 0) return -1;
+
+  return (reduce_tree_()) ?
+    ip_write + (rank - 1) / reduce_arity_ : ip_write;
+}
+
+//----------------------------------------------------------------------
+
+int Output::num_children() const throw()
+{
+  const int ip = CkMyPe();
+  const int ip_write = process_writer();
+  const int rank = ip - ip_write;
+
+  // number of processes sharing this process's writer
+  const int np = std::min(stride_write_, CkNumPes() - ip_write);
+
+  if (! reduce_tree_()) return (rank == 0) ? np - 1 : 0;
+
+  // children of rank r are ranks r*arity + 1 to r*arity + arity
+  const int rank_child = rank * reduce_arity_ + 1;
+  return std::max(0, std::min(rank_child + reduce_arity_, np) - rank_child);
+}
+
+//----------------------------------------------------------------------
+
 void Output::set_schedule (Schedule * schedule) throw()
 { 
   if (schedule_) delete schedule_;
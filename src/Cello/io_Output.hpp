@@ -59,7 +59,8 @@ public: // functions
       it_field_index_(nullptr),        // set_it_index_field()
       it_particle_index_(nullptr),        // set_it_index_particle()
       stride_write_(1),// default one file per process
-      stride_wait_(0) // default no synchronization of writes
+      stride_wait_(0), // default no synchronization of writes
+      reduce_arity_(0) // default all processes send to the writer
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -118,9 +119,20 @@ public: // functions
   void set_stride_write (int stride) throw () 
   {
     stride_write_ = stride; 
-    sync_write_.set_stop(stride_write_);
+    sync_write_.set_stop(1 + num_children());
   }
 
+  /// Set the arity of the tree through which processes send data to
+  /// their writer, or 0 for all processes to send directly to it
+  void set_reduce_arity (int arity) throw ()
+  {
+    reduce_arity_ = arity;
+    sync_write_.set_stop(1 + num_children());
+  }
+
+  int reduce_arity () const throw ()
+  { return reduce_arity_; }
+
   int stride_write () const throw () 
   { return stride_write_; }
 
@@ -138,6 +150,14 @@ public: // functions
     return ip - (ip % stride_write_);
   }
 
+  /// Return the process id to send this process's data to, or -1 for
+  /// the writer
+  int process_parent() const throw();
+
+  /// Return the number of processes that send their data to this
+  /// process
+  int num_children() const throw();
+
   /// Return the updated timestep if time + dt goes past a scheduled output
   double update_timestep (double time, double dt) const throw ();
 
@@ -245,6 +265,12 @@ protected:
   /// write version metadata to disk
   void write_version_metadata() { cello::io::write_version_metadata(file_); }
 
+  /// Whether data is reduced through a tree of processes.  Only with
+  /// unstaggered writes, since interior processes must be active
+  /// while their children send
+  bool reduce_tree_() const throw()
+  { return reduce_arity_ > 0 && stride_wait_ <= 1; }
+
 private:
 
   /// "Loop" over writing the Hierarchy in the Simulation
@@ -315,6 +341,10 @@ protected: // attributes
   
   int stride_wait_;
 
+  /// Arity of the tree of processes rooted at the writer through which
+  /// data are sent (0: all send directly to the writer)
+  int reduce_arity_;
+
 };
 
 #endif /* IO_OUTPUT_HPP */
@@ -21,7 +21,11 @@ OutputData::OutputData
  Config * config
 ) throw ()
   : Output(index,factory),
-    text_block_count_(0)
+    text_block_count_(0),
+    compress_level_(config->output_compress_level[index]),
+    shuffle_(config->output_shuffle[index]),
+    chunk_size_(config->output_chunk_size[index]),
+    truncate_bits_(config->output_truncate_bits[index])
 {
   // Set process stride, with default = 1
 
@@ -60,6 +64,10 @@ void OutputData::pup (PUP::er &p)
   Output::pup(p);
 
   p | text_block_count_;
+  p | compress_level_;
+  p | shuffle_;
+  p | chunk_size_;
+  p | truncate_bits_;
 }
 
 //======================================================================
@@ -77,7 +85,14 @@ void OutputData::open () throw()
     ("Output","writing data file %s",
      (dir + "/" + file_name).c_str());
 
-  file_ = new FileHdf5 (dir,file_name);
+  FileHdf5 * file = new FileHdf5 (dir,file_name);
+
+  file->set_compress(compress_level_);
+  file->set_shuffle(shuffle_);
+  file->set_chunk_size(chunk_size_);
+  file->set_truncate_bits(truncate_bits_);
+
+  file_ = file;
 
   file_->file_create();
 }
@@ -89,7 +104,15 @@ void OutputData::close () throw()
 #ifdef TRACE_OUTPUT
     CkPrintf ("%d TRACE_OUTPUT OutputData::close()\n",CkMyPe());
 #endif    
-  if (file_) file_->file_close();
+  if (file_) {
+    file_->file_close();
+    FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+    Performance * performance = cello::simulation()->performance();
+    performance->increment_counter
+      (perf_index_disk_bytes, file->bytes_written());
+    performance->increment_counter
+      (perf_index_disk_usec, (long long)(1e6*file->time_write()));
+  }
   delete file_;  file_ = 0;
 }
 
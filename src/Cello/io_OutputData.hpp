@@ -21,7 +21,13 @@ class OutputData : public Output {
 public: // functions
 
   /// Empty constructor for Charm++ pup()
-  OutputData() throw() : text_block_count_(0) {}
+  OutputData() throw()
+    : text_block_count_(0),
+      compress_level_(0),
+      shuffle_(true),
+      chunk_size_(0),
+      truncate_bits_(0)
+  {}
 
   /// Create an uninitialized OutputData object
   OutputData(int index_output,
@@ -37,7 +43,11 @@ public: // functions
   /// Charm++ PUP::able migration constructor
   OutputData (CkMigrateMessage *m)
     : Output (m),
-      text_block_count_(0)
+      text_block_count_(0),
+      compress_level_(0),
+      shuffle_(true),
+      chunk_size_(0),
+      truncate_bits_(0)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -80,6 +90,18 @@ protected:
   /// Count of number of Blocks sent from local process for text file
   /// output
   int text_block_count_;
+
+  /// HDF5 deflate compression level, 0 for none
+  int compress_level_;
+
+  /// Whether to shuffle bytes before compressing
+  bool shuffle_;
+
+  /// Maximum HDF5 chunk extent along each axis, 0 for whole datasets
+  int chunk_size_;
+
+  /// Number of low-order mantissa bits to round away (lossy)
+  int truncate_bits_;
 };
 
 #endif /* IO_OUTPUT_DATA_HPP */
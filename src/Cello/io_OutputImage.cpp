@@ -59,7 +59,8 @@ OutputImage::OutputImage(int index,
   include_ghost_(ghost),
   min_level_(min_level),
   max_level_(max_level),
-  leaf_only_(leaf_only)
+  leaf_only_(leaf_only),
+  reduce_float_(false)
 {
   int root_size[3] =
     {root_size_in[0], root_size_in[1], root_size_in[2]};
@@ -67,6 +68,8 @@ OutputImage::OutputImage(int index,
     {root_blocks_in[0], root_blocks_in[1], root_blocks_in[2]};
   image_size_[0] = image_size[0];
   image_size_[1] = image_size[1];
+  image_bounds_[0] = image_bounds_[2] = 0;
+  image_bounds_[1] = image_bounds_[3] = -1;
   if      (image_reduce_type=="min") { op_reduce_ = reduce_min; }
   else if (image_reduce_type=="max") { op_reduce_ = reduce_max; }
   else if (image_reduce_type=="avg") { op_reduce_ = reduce_avg; }
@@ -201,6 +204,8 @@ void OutputImage::pup (PUP::er &p)
   p | leaf_only_;
   PUParray(p,image_lower_,3);
   PUParray(p,image_upper_,3);
+  PUParray(p,image_bounds_,4);
+  p | reduce_float_;
 }
 
 //----------------------------------------------------------------------
@@ -528,71 +533,133 @@ void OutputImage::write_particle_data
 
 void OutputImage::prepare_remote (int * n, char ** buffer) throw()
 {
-  int size = 0;
-  int nx = image_size_[0];
-  int ny = image_size_[1];
+  // Send only the bounding rectangle of pixels modified by this
+  // process and its children in the reduction tree
+
+  const int * bounds = image_bounds_;
+  const bool is_empty = (bounds[0] > bounds[1]);
+  const int mx = is_empty ? 0 : bounds[1] - bounds[0] + 1;
+  const int my = is_empty ? 0 : bounds[3] - bounds[2] + 1;
+  const int bytes = reduce_float_ ? sizeof(float) : sizeof(double);
 
   // Determine buffer size
 
-  size += 2*sizeof(int);        // image_size_[0], image_size_[1]
-  size += nx*ny*sizeof(double); // image_data_
-  size += nx*ny*sizeof(double); // image_mesh_
+  int size = 0;
+
+  size += 8*sizeof(int);   // image_size_[2], image_bounds_[4], precision, pad
+  size += mx*my*bytes;     // image_data_ in bounds
+  size += mx*my*bytes;     // image_mesh_ in bounds
   (*n) = size;
 
   // Allocate buffer (deallocated in cleanup_remote())
   TRACE_MEMORY("new buffer",size);
   (*buffer) = new char [ size ];
 
-  union {
-    char   * c;
-    double * d;
-    int    * i;
-  } p ;
-
-  p.c = (*buffer);
+  int * header = (int *)(*buffer);
 
-  *p.i++ = nx;
-  *p.i++ = ny;
+  header[0] = image_size_[0];
+  header[1] = image_size_[1];
+  for (int i=0; i<4; i++) header[2+i] = bounds[i];
+  header[6] = reduce_float_ ? 1 : 0;
+  header[7] = 0;
 
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_data_[k];
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_mesh_[k];
+  char * p = (*buffer) + 8*sizeof(int);
 
+  if (! is_empty) {
+    if (reduce_float_) {
+      p = save_bounds_<float> (image_data_,p);
+      p = save_bounds_<float> (image_mesh_,p);
+    } else {
+      p = save_bounds_<double> (image_data_,p);
+      p = save_bounds_<double> (image_mesh_,p);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
 
 void OutputImage::update_remote  ( int m, char * buffer) throw()
 {
-  union {
-    char   * c;
-    double * d;
-    int    * i;
-  } p ;
-
-  p.c = buffer;
-
-  const int nx = *p.i++;
-  const int ny = *p.i++;
-
-  const int n = nx*ny;
-
-  if (op_reduce_ == reduce_min) {
-    for (int k=0; k<n; k++) image_data_[k] = std::min(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::min(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_max) {
-    for (int k=0; k<n; k++) image_data_[k] = std::max(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::max(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_sum) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_avg) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_set) {
-    for (int k=0; k<n; k++) image_data_[k]  = *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k]  = *p.d++;
+  const int * header = (const int *)buffer;
+
+  ASSERT4 ("OutputImage::update_remote()",
+           "Received image size %d x %d differs from image size %d x %d",
+           header[0],header[1],image_size_[0],image_size_[1],
+           (header[0] == image_size_[0] && header[1] == image_size_[1]));
+
+  int bounds[4];
+  for (int i=0; i<4; i++) bounds[i] = header[2+i];
+  const bool is_float = (header[6] != 0);
+
+  if (bounds[0] > bounds[1]) return;
+
+  char * p = buffer + 8*sizeof(int);
+
+  if (is_float) {
+    p = load_bounds_<float> (image_data_,p,bounds);
+    p = load_bounds_<float> (image_mesh_,p,bounds);
+  } else {
+    p = load_bounds_<double> (image_data_,p,bounds);
+    p = load_bounds_<double> (image_mesh_,p,bounds);
   }
 
+  extend_bounds_(bounds[0],bounds[1],bounds[2],bounds[3]);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+char * OutputImage::save_bounds_
+(const double * image, char * buffer) const throw()
+{
+  // clamp to the range of T: clamped values at the limits are
+  // recognized as the initial values of min and max reductions
+
+  const double max = std::numeric_limits<T>::max();
+
+  T * values = (T *)buffer;
+  for (int iy=image_bounds_[2]; iy<=image_bounds_[3]; iy++) {
+    for (int ix=image_bounds_[0]; ix<=image_bounds_[1]; ix++) {
+      const double value = image[ix + image_size_[0]*iy];
+      *values++ = (T) std::max(-max,std::min(max,value));
+    }
+  }
+  return (char *)values;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+char * OutputImage::load_bounds_
+(double * image, char * buffer, const int bounds[4]) const throw()
+{
+  const double max = std::numeric_limits<T>::max();
+
+  const T * values = (const T *)buffer;
+  for (int iy=bounds[2]; iy<=bounds[3]; iy++) {
+    for (int ix=bounds[0]; ix<=bounds[1]; ix++) {
+      const double value = *values++;
+      double & pixel = image[ix + image_size_[0]*iy];
+      switch (op_reduce_) {
+      case reduce_min:
+        if (value < max) pixel = std::min(pixel,value);
+        break;
+      case reduce_max:
+        if (value > -max) pixel = std::max(pixel,value);
+        break;
+      case reduce_avg:
+      case reduce_sum:
+        pixel += value;
+        break;
+      case reduce_set:
+        pixel = value;
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  return (char *)values;
 }
 
 //----------------------------------------------------------------------
@@ -692,6 +759,10 @@ void OutputImage::image_create_ () throw()
   for (int i=0; i<image_size_[0]*image_size_[1]; i++) image_data_[i] = value0;
   for (int i=0; i<image_size_[0]*image_size_[1]; i++) image_mesh_[i] = value0;
 
+  // no pixels modified yet
+  image_bounds_[0] = image_bounds_[2] = 0;
+  image_bounds_[1] = image_bounds_[3] = -1;
+
 }
 
 //----------------------------------------------------------------------
@@ -797,6 +868,8 @@ void OutputImage::reduce_point_
   }
   const int i = ix + image_size_[0]*iy;
 
+  extend_bounds_(ix,ix,iy,iy);
+
   double value_new = 0.0;
 
   switch (op_reduce_) {
@@ -79,8 +79,11 @@ public: // functions
       include_ghost_(false),
       min_level_(0),
       max_level_(0),
-      leaf_only_(false)
+      leaf_only_(false),
+      reduce_float_(false)
   {
+    image_bounds_[0] = image_bounds_[2] = 0;
+    image_bounds_[1] = image_bounds_[3] = -1;
     colormap_[0].clear();
     colormap_[1].clear();
     colormap_[2].clear();
@@ -96,6 +99,11 @@ public: // functions
   // Set the image colormap
   void set_colormap (std::vector<float> colormap[3]);
 
+  /// Set whether to send image data to parent processes in single
+  /// rather than double precision
+  void set_reduce_float (bool reduce_float)
+  { reduce_float_ = reduce_float; }
+
 public: // virtual functions
 
   /// Prepare for accumulating block data
@@ -188,6 +196,31 @@ private: // functions
   void reduce_box_filled_(double * data, int ixm, int ixp, int iym, int iyp, 
 		    double value, double alpha=1.0);
 
+  /// Extend the bounding rectangle of modified pixels
+  void extend_bounds_ (int ixm, int ixp, int iym, int iyp) throw()
+  {
+    if (image_bounds_[0] > image_bounds_[1]) {
+      image_bounds_[0] = ixm;  image_bounds_[1] = ixp;
+      image_bounds_[2] = iym;  image_bounds_[3] = iyp;
+    } else {
+      image_bounds_[0] = std::min(image_bounds_[0],ixm);
+      image_bounds_[1] = std::max(image_bounds_[1],ixp);
+      image_bounds_[2] = std::min(image_bounds_[2],iym);
+      image_bounds_[3] = std::max(image_bounds_[3],iyp);
+    }
+  }
+
+  /// Copy the bounding rectangle of image into the buffer as type T,
+  /// returning the next position in the buffer
+  template <class T>
+  char * save_bounds_ (const double * image, char * buffer) const throw();
+
+  /// Reduce the rectangle of pixels in the buffer of type T into
+  /// image, returning the next position in the buffer
+  template <class T>
+  char * load_bounds_ (double * image, char * buffer,
+                       const int bounds[4]) const throw();
+
 private: // attributes
 
   /// Color map
@@ -249,7 +282,13 @@ private: // attributes
   /// Lower and upper bounds on image (can be used for slices)
   double image_lower_[3];
   double image_upper_[3];
-  
+
+  /// Bounding rectangle [ixm,ixp] x [iym,iyp] of pixels modified by
+  /// this process or received from its children, empty if ixm > ixp
+  int image_bounds_[4];
+
+  /// Whether to send image data in single precision
+  bool reduce_float_;
 };
 
 #endif /* IO_OUTPUT_IMAGE_HPP */
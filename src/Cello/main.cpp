@@ -53,6 +53,11 @@ extern CProxy_EnzoSimulation proxy_simulation;
 void Main::p_exit(int count)
 {
   DEBUG("Main::p_exit");
+#ifdef CHARM_ENZO
+  // wait for checkpoint files still being written
+  EnzoSimulation * simulation = enzo::simulation();
+  if (simulation && simulation->check_defer_exit(count)) return;
+#endif
   count_exit_++;
   unit_finalize();
   if (count_exit_ >= count) {
@@ -62,6 +62,10 @@ void * Memory::allocate ( size_t bytes )
     CmiAbort("MEMORY ALLOCATION ERROR");
   }
 
+  if (sample_interval_ > 0 || sample_bytes_min_ > 0) {
+    sample_(bytes);
+  }
+
   int * buffer = (int *)(std::malloc(bytes + 2*sizeof(int)));
 
   ASSERT("Memory::allocate",
@@ -138,11 +142,16 @@ void Memory::deallocate ( void * pointer )
 
 //----------------------------------------------------------------------
 
-void Memory::new_group ( std::string group_name )
+int Memory::new_group ( std::string group_name )
 /// @param  group_name  Name of the group
+/// @return             Index of the group
 {
 #ifdef CONFIG_USE_MEMORY
 
+  for (size_t index=0; index<group_name_.size(); index++) {
+    if (group_name_[index] == group_name) return index;
+  }
+
   group_name_.push_back(group_name);
   bytes_limit_  .push_back(0);
   bytes_curr_   .push_back(0);
@@ -150,7 +159,12 @@ void Memory::new_group ( std::string group_name )
   bytes_highest_.push_back(0);
   new_calls_    .push_back(0);
   delete_calls_ .push_back(0);
-  
+  sample_new_calls_.push_back(0);
+  sample_new_bytes_.push_back(0);
+
+  return group_name_.size() - 1;
+#else
+  return 0;
 #endif
 }
 
@@ -269,6 +283,61 @@ int Memory::num_delete ( std::string group_name )
 
 //----------------------------------------------------------------------
 
+int64_t Memory::num_workspace_new ()
+{
+  return Workspace::instance()->num_new();
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::num_workspace_reuse ()
+{
+  return Workspace::instance()->num_reuse();
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::bytes_workspace ()
+{
+  return Workspace::instance()->bytes();
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::sample_new_calls (int index_group) const
+{
+#ifdef CONFIG_USE_MEMORY
+  return sample_new_calls_.at(index_group);
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::sample_new_bytes (int index_group) const
+{
+#ifdef CONFIG_USE_MEMORY
+  return sample_new_bytes_.at(index_group);
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void Memory::reset_sample ()
+{
+#ifdef CONFIG_USE_MEMORY
+  for (size_t i=0; i<sample_new_calls_.size(); i++) {
+    sample_new_calls_[i] = 0;
+    sample_new_bytes_[i] = 0;
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+
 void Memory::print ()
 {
 #ifdef CONFIG_USE_MEMORY
@@ -282,8 +351,19 @@ void Memory::print ()
       monitor->print ("Memory","  bytes_limit   = %ld",long(bytes_limit_[i]));
       monitor->print ("Memory","  new_calls     = %ld",long(new_calls_[i]));
       monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls_[i]));
+      if (is_sampling()) {
+        monitor->print ("Memory","  sample_new_calls = %ld",
+                        long(sample_new_calls_[i]));
+        monitor->print ("Memory","  sample_new_bytes = %ld",
+                        long(sample_new_bytes_[i]));
+      }
     }
   }
+  Monitor * monitor = Monitor::instance();
+  monitor->print ("Memory","Workspace");
+  monitor->print ("Memory","  bytes         = %ld",long(bytes_workspace()));
+  monitor->print ("Memory","  new_calls     = %ld",long(num_workspace_new()));
+  monitor->print ("Memory","  reuse_calls   = %ld",long(num_workspace_reuse()));
 #endif
 }
 
@@ -300,6 +380,8 @@ void Memory::reset()
     bytes_highest_ [i] = 0;
     new_calls_     [i] = 0;
     delete_calls_  [i] = 0;
+    sample_new_calls_[i] = 0;
+    sample_new_bytes_[i] = 0;
   }
 #endif
 }
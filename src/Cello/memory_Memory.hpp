@@ -33,7 +33,10 @@ private: // interface
 #ifdef CONFIG_USE_MEMORY
   : is_active_(false),
     warning_mb_(0.0),
-    limit_gb_ (0.0)
+    limit_gb_ (0.0),
+    sample_interval_(0),
+    sample_bytes_min_(0),
+    sample_countdown_(0)
 #endif
   { initialize_(); }
 
@@ -57,6 +60,8 @@ public: // interface
     p | fill_new_;
     p | fill_delete_;
     p | bytes_limit_;
+    p | sample_interval_;
+    p | sample_bytes_min_;
 #endif
     static bool warn[CONFIG_NODE_SIZE] = {false};
     const int in = cello::index_static();
@@ -77,10 +82,18 @@ public: // interface
   /// De-allocate memory
   void deallocate ( void * pointer );
 
-  /// Define a new group
-  void new_group ( std::string group_name );
+  /// Define a new group if not already defined, and return its index
+  int new_group ( std::string group_name );
 
-  int index_group(std::string group_name = "") const
+  /// Return the number of groups, including the default group 0
+  int num_groups () const
+  { return group_name_.size(); }
+
+  /// Return the name of the given group
+  std::string group_name (int index_group) const
+  { return group_name_.at(index_group); }
+
+  int index_group(const std::string & group_name = "") const
   {
     int index_group = 0;
     for (size_t index=0; index<group_name_.size(); index++) {
@@ -90,11 +103,20 @@ public: // interface
   }
 
   /// Begin allocating/deallocating memory associated with the given group
-  void set_group ( std::string group_name ) 
+  void set_group ( const std::string & group_name ) 
   {
     index_group_ = this->index_group(group_name);
   }
 
+  /// Begin allocating/deallocating memory associated with the given
+  /// group index, e.g. as returned by new_group()
+  void set_group_index ( int index_group )
+  { index_group_ = index_group; }
+
+  /// Return the index of the current group
+  int group_index () const
+  { return index_group_; }
+
   std::string group () const 
   { return group_name_[index_group_]; }
 
@@ -126,6 +148,50 @@ public: // interface
   /// Return the number of calls to deallocate for the group
   int num_delete ( std::string group = "" );
 
+  /// Return the number of scratch arrays allocated by the Workspace
+  int64_t num_workspace_new ();
+
+  /// Return the number of Workspace requests served without allocating
+  int64_t num_workspace_reuse ();
+
+  /// Return the number of bytes held by the Workspace
+  int64_t bytes_workspace ();
+
+  /// Sample allocations: record every sample_interval'th allocation,
+  /// and every allocation of at least sample_bytes bytes, with the
+  /// current group.  Zero disables the corresponding criteria.
+  void set_sampling (int64_t sample_interval, int64_t sample_bytes)
+#ifdef CONFIG_USE_MEMORY
+  {
+    sample_interval_  = sample_interval;
+    sample_bytes_min_ = sample_bytes;
+    sample_countdown_ = sample_interval;
+  }
+#else
+  { }
+#endif
+
+  /// Whether allocations are being sampled
+  bool is_sampling () const
+  {
+#ifdef CONFIG_USE_MEMORY
+    return (sample_interval_ > 0 || sample_bytes_min_ > 0);
+#else
+    return false;
+#endif
+  }
+
+  /// Estimated number of allocations in the group since
+  /// reset_sample(), where group 0 is the total over all groups
+  int64_t sample_new_calls (int index_group) const;
+
+  /// Estimated number of bytes allocated in the group since
+  /// reset_sample(), where group 0 is the total over all groups
+  int64_t sample_new_bytes (int index_group) const;
+
+  /// Clear sampled allocation counts, e.g. after performance output
+  void reset_sample ();
+
   /// Print memory summary
   void print ();
 
@@ -189,6 +255,30 @@ private: // functions
   /// Initialize the memory component
   void initialize_();
 
+  /// Record a sampled allocation with the current group
+  void sample_ (size_t bytes)
+  {
+#ifdef CONFIG_USE_MEMORY
+    int64_t weight = 0;
+    if (sample_bytes_min_ > 0 && int64_t(bytes) >= sample_bytes_min_) {
+      // large allocations are always recorded
+      weight = 1;
+    } else if (sample_interval_ > 0 && -- sample_countdown_ <= 0) {
+      // each sampled allocation stands for sample_interval_ allocations
+      sample_countdown_ = sample_interval_;
+      weight = sample_interval_;
+    }
+    if (weight > 0) {
+      sample_new_calls_[0] += weight;
+      sample_new_bytes_[0] += weight*bytes;
+      if (index_group_ != 0) {
+        sample_new_calls_[index_group_] += weight;
+        sample_new_bytes_[index_group_] += weight*bytes;
+      }
+    }
+#endif
+  }
+
   //======================================================================
 
 private: // attributes
@@ -233,6 +323,21 @@ private: // attributes
   /// Limit on total memory allocated before error (to prevent crashing machine)
   float  limit_gb_;
 
+  /// Record every sample_interval_'th allocation, or 0 for none
+  int64_t sample_interval_;
+
+  /// Record every allocation of at least this many bytes, or 0 for none
+  int64_t sample_bytes_min_;
+
+  /// Number of allocations until the next sample
+  int64_t sample_countdown_;
+
+  /// Estimated number of allocations for different groups from sampling
+  std::vector<int64_t> sample_new_calls_;
+
+  /// Estimated bytes allocated for different groups from sampling
+  std::vector<int64_t> sample_new_bytes_;
+
 #endif
 
   /// The current group index, or 0 if none
@@ -0,0 +1,68 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file      memory_Workspace.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-17
+/// @brief     Implementation of the Workspace scratch array pool
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+Workspace Workspace::instance_[CONFIG_NODE_SIZE]; // (singleton design pattern)
+
+//======================================================================
+
+void * Workspace::allocate_bytes ( size_t bytes )
+{
+  // round up so that arrays of different types with the same total
+  // size share the same pool
+  bytes = std::max(bytes,size_t(1));
+  bytes = ((bytes + sizeof(double) - 1) / sizeof(double)) * sizeof(double);
+
+  char * array = nullptr;
+
+  auto it = free_.find(bytes);
+  if (it != free_.end() && ! it->second.empty()) {
+    array = it->second.back();
+    it->second.pop_back();
+    ++num_reuse_;
+  } else {
+    array = new char [bytes];
+    ++num_new_;
+    bytes_ += bytes;
+  }
+
+  in_use_[array] = bytes;
+
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+void Workspace::release ( void * array )
+{
+  if (array == nullptr) return;
+
+  auto it = in_use_.find(array);
+
+  ASSERT ("Workspace::release()",
+          "Array was not allocated by the Workspace",
+          it != in_use_.end());
+
+  free_[it->second].push_back((char *)array);
+  in_use_.erase(it);
+}
+
+//----------------------------------------------------------------------
+
+void Workspace::clear ()
+{
+  for (auto & entry : free_) {
+    for (char * array : entry.second) {
+      delete [] array;
+      bytes_ -= entry.first;
+    }
+  }
+  free_.clear();
+}
@@ -0,0 +1,96 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_Workspace.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Declaration of the Workspace class, a
+/// per-process pool of reusable scratch arrays
+
+#ifndef MEMORY_WORKSPACE_HPP
+#define MEMORY_WORKSPACE_HPP
+
+class Workspace {
+
+  /// @class    Workspace
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Pool of scratch arrays keyed by size
+  ///
+  /// Methods that need temporary arrays for each Block (e.g. for
+  /// Fortran solvers) draw them from the Workspace instead of the
+  /// heap.  Released arrays are kept and handed out again to the next
+  /// request of the same size, so Blocks of equal shape share the same
+  /// arrays and no allocations occur once all sizes have been seen.
+  /// Arrays must be released before the entry method returns.
+
+public: // interface
+
+  /// Get the Workspace object for this process
+  static Workspace * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Return an array of n values of type T; contents are undefined
+  template <class T>
+  T * allocate (size_t n)
+  { return (T *) allocate_bytes (n*sizeof(T)); }
+
+  /// Return an array of the given number of bytes
+  void * allocate_bytes (size_t bytes);
+
+  /// Return an array obtained from allocate() to the pool
+  void release (void * array);
+
+  /// Delete all pooled arrays that are not currently in use
+  void clear ();
+
+  /// Number of arrays allocated from the heap
+  int64_t num_new () const
+  { return num_new_; }
+
+  /// Number of requests satisfied by reusing a pooled array
+  int64_t num_reuse () const
+  { return num_reuse_; }
+
+  /// Number of arrays currently in use
+  int num_active () const
+  { return in_use_.size(); }
+
+  /// Total bytes held by the pool, whether in use or not
+  int64_t bytes () const
+  { return bytes_; }
+
+private: // functions
+
+  Workspace ()
+    : free_(),
+      in_use_(),
+      num_new_(0),
+      num_reuse_(0),
+      bytes_(0)
+  { }
+
+  Workspace (const Workspace &) = delete;
+  Workspace & operator= (const Workspace &) = delete;
+
+private: // attributes
+
+  /// Single instance per process (singleton design pattern)
+  static Workspace instance_[CONFIG_NODE_SIZE];
+
+  /// Released arrays available for reuse, keyed by size in bytes
+  std::map< size_t, std::vector<char *> > free_;
+
+  /// Sizes of arrays currently handed out
+  std::map< void *, size_t > in_use_;
+
+  /// Number of arrays allocated from the heap
+  int64_t num_new_;
+
+  /// Number of requests satisfied from the pool
+  int64_t num_reuse_;
+
+  /// Total bytes allocated by the pool
+  int64_t bytes_;
+
+};
+
+#endif /* MEMORY_WORKSPACE_HPP */
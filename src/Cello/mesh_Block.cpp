@@ -65,8 +65,10 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     name_(""),
     index_method_(-1),
     index_solver_(),
+    time_solver_(),
     refresh_(),
-    index_(thisIndex)
+    index_(thisIndex),
+    compute_time_(0.0)
 {
 #ifdef TRACE_BLOCK
 
@@ -329,6 +331,7 @@ void Block::pup(PUP::er &p)
   p | name_;
   p | index_method_;
   p | index_solver_;
+  p | time_solver_;
   p | refresh_;
   // SKIP method_: initialized when needed
 
@@ -347,6 +350,7 @@ void Block::pup(PUP::er &p)
 
   p | index_order_;
   p | count_order_;
+  p | compute_time_;
 }
 
 //----------------------------------------------------------------------
@@ -613,6 +617,8 @@ Block::~Block()
     delete [] array;
   }
 
+  refresh_face_clear_();
+
   delete data_;
   data_ = 0;
 
@@ -678,7 +684,9 @@ Block::Block ()
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    time_solver_(),
+    refresh_(),
+    compute_time_(0.0)
 {
   init_refresh_();
   init_adapt_(nullptr);
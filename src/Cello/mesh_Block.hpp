@@ -10,6 +10,7 @@
 #define MESH_BLOCK_HPP
 
 class Data;
+class DataMsg;
 class MsgRefresh;
 class MsgRefine;
 class MsgCoarsen;
@@ -124,6 +125,14 @@ public: // interface
   bool stop() const throw()
   { return stop_; };
 
+  /// Return whether the Block's level begins a step this cycle.
+  /// Always true unless subcycling ("Stopping:subcycle")
+  bool subcycle_active() const;
+
+  /// Return whether the Block's level ends a step this cycle.
+  /// Always true unless subcycling ("Stopping:subcycle")
+  bool subcycle_closing() const;
+
   /// Return whether this Block is a leaf in the octree array
   bool is_leaf() const
   { return is_leaf_; }
@@ -322,6 +331,7 @@ public: // interface
   void push_solver(int index_solver) throw()
   {
     index_solver_.push_back(index_solver);
+    time_solver_.push_back(CmiWallTimer());
   }
 
   /// Return from a solver
@@ -332,9 +342,16 @@ public: // interface
 	    "Trying to pop element off of empty Block::index_solver_ stack",
 	    index_solver_.size() > 0);
     index_solver_.resize(index_solver_.size()-1);
+    time_solver_.resize(time_solver_.size()-1);
     return index;
   }
 
+  /// Return the wall time elapsed since the current solver started
+  double solver_time() const throw()
+  {
+    return time_solver_.empty() ? 0.0 : CmiWallTimer() - time_solver_.back();
+  }
+
   /// Return the index of the current solver
   int index_solver() const throw()
   {
@@ -357,6 +374,13 @@ public: // interface
   { *index = index_order_;
     *count = count_order_;
   }
+
+  /// Return the wall time spent in Method::compute() since the last
+  /// call to reset_compute_time(), e.g. for cost-weighted ordering
+  double compute_time() const
+  { return compute_time_; }
+  void reset_compute_time()
+  { compute_time_ = 0.0; }
   
 protected: // methods
 
@@ -580,6 +604,14 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_refresh_recv (MsgRefresh * msg);
 
+  /// Receive a packed field face from an aggregated refresh message
+  /// that was forwarded because this Block was not on the expected process
+  void p_refresh_recv_face (int id_refresh, int n, char * buffer);
+
+  /// Receive a packed field face extracted from an aggregated refresh
+  /// message by the local Simulation object
+  void refresh_recv_face (int id_refresh, int n, char * buffer);
+
   int refresh_load_field_faces_ (Refresh & refresh);
   
   /// Scatter particles in ghost zones to neighbors
@@ -611,13 +643,17 @@ public:
 
   void r_method_order_morton_continue(CkReductionMsg * msg);
   void r_method_order_morton_complete(CkReductionMsg * msg);
-  void p_method_order_morton_weight(int ic3[3], int weight, Index index);
-  void p_method_order_morton_index(int index, int count);
+  void p_method_order_morton_weight
+  (int ic3[3], int weight, double cost, Index index);
+  void p_method_order_morton_index
+  (int index, int count, double cost_index, double cost_count);
 
   void r_method_order_hilbert_continue(CkReductionMsg * msg);
   void r_method_order_hilbert_complete(CkReductionMsg * msg);
-  void p_method_order_hilbert_weight(int ic3[3], int weight, Index index);
-  void p_method_order_hilbert_index(int index, int count);
+  void p_method_order_hilbert_weight
+  (int ic3[3], int weight, double cost, Index index);
+  void p_method_order_hilbert_index
+  (int index, int count, double cost_index, double cost_count);
 
   void p_method_output_next (MsgOutput * msg);
   void p_method_output_write (MsgOutput * msg);
@@ -653,6 +689,22 @@ protected:
   /// Apply prolongation operations on Block
   void refresh_coarse_apply_(Refresh * refresh);
 
+  /// Append the packed DataMsg to the aggregated refresh buffer for
+  /// the given destination process
+  void refresh_aggregate_face_
+  (int ip, Index index, int id_refresh, DataMsg * data_msg);
+
+  /// Send aggregated refresh buffers, one message per destination process
+  void refresh_aggregate_send_();
+
+  /// Return the cached FieldFace for sending the given face in the
+  /// given refresh, creating it if needed
+  FieldFace * refresh_face_
+  (Refresh & refresh, int refresh_type, int if3[3], int ic3[3]);
+
+  /// Delete cached FieldFace objects, e.g. when neighbor levels change
+  void refresh_face_clear_();
+
   /// Scatter particles in ghost zones to neighbors
   int refresh_load_particle_faces_ (Refresh * refresh);
 
@@ -758,6 +810,10 @@ protected:
   void stopping_load_balance_();
   void stopping_exit_();
 
+  /// Weight of the field history when interpolating in time the
+  /// field values sent to neighbors when subcycling
+  double subcycle_history_weight_() const;
+
 public:
   /// Exit the stopping phase to exit
   void p_exit ()
@@ -1037,6 +1093,9 @@ protected: // attributes
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
 
+  /// Stack of wall times when each active Solver was started
+  std::vector<double> time_solver_;
+
   /// Refresh object associated with current refresh operation
   /// (Not a pointer since must be one per Block for synchronization counters)
   std::vector<Refresh*> refresh_;
@@ -1044,9 +1103,21 @@ protected: // attributes
   std::vector < Sync > refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > refresh_msg_list_;
 
+  /// Packed field faces for neighbors on other processes, indexed by
+  /// destination process; buffers keep their capacity between refreshes
+  std::map < int, std::vector<char> > refresh_aggregate_;
+
+  /// FieldFace objects for sending field faces, indexed by refresh
+  /// id, refresh type, face, and child; valid until neighbor levels
+  /// change in the adapt phase
+  std::map < int, FieldFace * > refresh_face_cache_;
+
   /// Index and total count used for ordering blocks, e.g. for dynamic load balancing
   long long index_order_;
   long long count_order_;
+
+  /// Wall time spent in Method::compute() since last reset
+  double compute_time_;
 };
 
 #endif /* COMM_BLOCK_HPP */
@@ -33,6 +33,51 @@ void Refine::set_schedule (Schedule * schedule) throw()
 
 //----------------------------------------------------------------------
 
+int Refine::apply_fused
+(Block * block, const std::vector<Refine *> & refine_list,
+ const int m3[3], const int i3[3], const int n3[3]) throw()
+{
+  const int level = block->level();
+
+  // criteria whose result can still change: those below their
+  // maximum level (which may still request refinement) and those
+  // for which all cells so far coarsen
+  std::vector<Refine *> active;
+  std::vector<char> can_refine;
+  for (Refine * refine : refine_list) {
+    active.push_back(refine);
+    can_refine.push_back(level < refine->max_level_);
+  }
+
+  // whether any criteria has a cell that does not coarsen
+  bool any_same = false;
+
+  for (int iz=i3[2]; iz<i3[2]+n3[2]; iz++) {
+    for (int iy=i3[1]; iy<i3[1]+n3[1]; iy++) {
+      for (int ix=i3[0]; ix<i3[0]+n3[0]; ix++) {
+        const int i = ix + m3[0]*(iy + m3[1]*iz);
+        for (size_t k=0; k<active.size(); k++) {
+          const int result = active[k]->evaluate_cell(i);
+          if (result == adapt_coarsen) continue;
+          if (result == adapt_refine && can_refine[k]) return adapt_refine;
+          any_same = true;
+          if (! can_refine[k]) {
+            // result is adapt_same and can no longer change
+            active.erase(active.begin()+k);
+            can_refine.erase(can_refine.begin()+k);
+            k--;
+          }
+        }
+        if (active.empty()) return adapt_same;
+      }
+    }
+  }
+
+  return (any_same || refine_list.empty()) ? adapt_same : adapt_coarsen;
+}
+
+//----------------------------------------------------------------------
+
 void * Refine::initialize_output_(FieldData * field_data)
 {
   void * output = 0;
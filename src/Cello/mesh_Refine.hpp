@@ -61,9 +61,39 @@ public: // interface
   /// Return the name of the refinement criteria
   virtual std::string name () const { return "unknown"; }
 
+  /// Prepare to evaluate the criteria one cell at a time with
+  /// evaluate_cell(), so that several criteria can share a single
+  /// sweep over the Block (see apply_fused()).  Returns false if not
+  /// supported for this Block, e.g. if an output field is written or
+  /// a field is not stored at the default precision; otherwise sets
+  /// the field dimensions m3 and the range [i3,i3+n3) of cells
+  /// evaluated
+  virtual bool prepare (Block * block, int m3[3], int i3[3], int n3[3])
+    throw()
+  { return false; }
+
+  /// Evaluate the criteria at index i of fields with the dimensions
+  /// set by prepare(), returning adapt_refine, adapt_same or
+  /// adapt_coarsen
+  virtual int evaluate_cell (int i) const throw()
+  { return adapt_same; }
+
+  /// Evaluate criteria prepared for the same cells in a single sweep,
+  /// returning the maximum of the results of their apply(), and
+  /// stopping as soon as one requests refinement
+  static int apply_fused (Block * block,
+                          const std::vector<Refine *> & refine_list,
+                          const int m3[3], const int i3[3], const int n3[3])
+    throw();
+
   /// Clear the output field to the default coarsen (-1)
   void * initialize_output_(FieldData * field_data);
 
+  /// Whether the criteria writes its result to an output field, in
+  /// which case it must be evaluated over the whole Block
+  bool has_output () const
+  { return output_ != ""; }
+
   /// Return the Schedule object pointer
   Schedule * schedule() throw() 
   { return schedule_; }
@@ -16,7 +16,8 @@ RefineDensity::RefineDensity
  int max_level,
  bool include_ghosts,
  std::string output) throw ()
-  : Refine(min_refine,max_coarsen,max_level,include_ghosts,output)
+  : Refine(min_refine,max_coarsen,max_level,include_ghosts,output),
+    density_(nullptr)
 {
   TRACE("RefineDensity::RefineDensity");
   WARNING ("RefineDensity::RefineDensity()",
@@ -79,23 +80,45 @@ int RefineDensity::apply_
   int gx, int gy, int gz ) const throw ()
 {
 
-  bool any_refine  = false;
   bool all_coarsen = true;
   for (int iz=gz; iz<mz-gz; iz++) {
     for (int iy=gy; iy<my-gy; iy++) {
       for (int ix=gx; ix<mx-gx; ix++) {
 	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] > max_coarsen_) all_coarsen = false;
+	const int result = evaluate_cell_(array,i);
+	if (result == adapt_refine) return adapt_refine;
+	if (result == adapt_same)   all_coarsen = false;
       }
     }
   }
-  return 
-    any_refine ?  adapt_refine :
-    (all_coarsen ? adapt_coarsen : adapt_same) ;
+  return all_coarsen ? adapt_coarsen : adapt_same;
 
 }
 
+//----------------------------------------------------------------------
+
+bool RefineDensity::prepare
+(Block * block, int m3[3], int i3[3], int n3[3]) throw()
+{
+  Field field = block->data()->field();
+
+  const int id = field.field_id ("density");
+
+  if (has_output() || field.precision(id) != default_precision) return false;
+
+  field.dimensions(id,&m3[0],&m3[1],&m3[2]);
+  if (include_ghosts_) {
+    i3[0] = i3[1] = i3[2] = 0;
+  } else {
+    field.ghost_depth(id, &i3[0],&i3[1],&i3[2]);
+  }
+  for (int i=0; i<3; i++) n3[i] = m3[i] - 2*i3[i];
+
+  density_ = (const cello_float *) field.values(id);
+
+  return true;
+}
+
 
 //======================================================================
 
@@ -30,7 +30,7 @@ public: // interface
 
   PUPable_decl(RefineDensity);
 
-  RefineDensity(CkMigrateMessage *m) : Refine (m) {}
+  RefineDensity(CkMigrateMessage *m) : Refine (m), density_(nullptr) {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -45,6 +45,12 @@ public: // interface
 
   virtual std::string name () const { return "density"; };
 
+  virtual bool prepare (Block * block, int m3[3], int i3[3], int n3[3])
+    throw();
+
+  virtual int evaluate_cell (int i) const throw()
+  { return evaluate_cell_(density_,i); }
+
 private: // functions
 
   template <class T>
@@ -52,6 +58,18 @@ private: // functions
 	      int mx, int my, int mz,
 	      int gx, int gy, int gz) const throw ();
 
+  template <class T>
+  inline int evaluate_cell_ (const T * array, int i) const throw ()
+  {
+    return (array[i] > min_refine_)  ? adapt_refine :
+      (   (array[i] > max_coarsen_) ? adapt_same : adapt_coarsen);
+  }
+
+private: // attributes
+
+  /// Density field of the Block set by prepare() (not checkpointed)
+  const cello_float * density_;
+
 };
 
 #endif /* MESH_REFINE_DENSITY_HPP */
@@ -16,7 +16,8 @@ RefineShear::RefineShear(double min_refine,
 			 int    max_level,
 			 bool   include_ghosts,
 			 std::string output) throw ()
-  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output)
+  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output),
+    rank_(0)
 {
 }
 
@@ -113,14 +114,9 @@ void RefineShear::evaluate_block_(const T * u,
 				  int rank)
 {
   T shear;
-  T uy = 0, vz = 0, wx = 0;
-  T uz = 0, vx = 0, wy = 0;
-  const int kx = 1;
-  const int ky = (rank >= 2) ? ndx : 0;
-  const int kz = (rank >= 3) ? ndx*ndy : 0;
-
-  // Compute inner-product of shear vector.  Note works for
-  // rank = 1, 2, 3 since 
+  const int k3[3] = { 1,
+                      (rank >= 2) ? ndx : 0,
+                      (rank >= 3) ? ndx*ndy : 0 };
 
 #ifdef TRACE_REFINE_SHEAR
   T min_shear = std::numeric_limits<T>::max();
@@ -130,23 +126,16 @@ void RefineShear::evaluate_block_(const T * u,
     for (int iy=gy; iy<ny+gy; iy++) {
       for (int ix=gx; ix<nx+gx; ix++) {
 	int i = ix + ndx*(iy + ndy*iz);
-	if (rank >= 2) {
-	  uy = u[i+ky] - u[i-ky]; uy *= uy;
-	  vx = v[i+kx] - v[i-kx]; vx *= vx;
-	} 
-	if (rank >= 3) {
-	  uz = u[i+kz] - u[i-kz]; uz *= uz;
-	  vz = v[i+kz] - v[i-kz]; vz *= vz;
-	  wx = w[i+kx] - w[i-kx]; wx *= wx;
-	  wy = w[i+ky] - w[i-ky]; wy *= wy;
-	}
-	shear = uy + uz + vx + vz + wx + wy;
+	shear = shear_(u,v,w,i,k3,rank);
 #ifdef TRACE_REFINE_SHEAR
 	min_shear = std::min(min_shear,shear);
 	max_shear = std::max(max_shear,shear);
 #endif
-	if (shear > min_refine_)  *any_refine  = true;
 	if (shear > max_coarsen_) *all_coarsen = false;
+	if (shear > min_refine_) {
+	  *any_refine  = true;
+	  if (! output) return;
+	}
 	if (output) {
 	  if (shear > max_coarsen_) output[i] =  0;
 	  if (shear > min_refine_)  output[i] = +1;
@@ -160,5 +149,48 @@ void RefineShear::evaluate_block_(const T * u,
     max_coarsen_, min_refine_);
 #endif  
 }
+//----------------------------------------------------------------------
+
+bool RefineShear::prepare
+(Block * block, int m3[3], int i3[3], int n3[3]) throw()
+{
+  Field field = block->data()->field();
+
+  const int id_velocity = field.field_id("velocity_x");
+
+  if (has_output() ||
+      field.precision(id_velocity) != default_precision) return false;
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+
+  rank_ = nz > 1 ? 3 : (ny > 1 ? 2 : 1);
+
+  int gx,gy,gz;
+  field.ghost_depth(id_velocity, &gx,&gy,&gz);
+
+  m3[0] = nx + 2*gx;
+  m3[1] = ny + 2*gy;
+  m3[2] = nz + 2*gz;
+
+  i3[0] = gx;
+  i3[1] = (rank_ >= 2) ? gy : 0;
+  i3[2] = (rank_ >= 3) ? gz : 0;
+
+  n3[0] = nx;
+  n3[1] = ny;
+  n3[2] = nz;
+
+  v3_[0] = (const cello_float *) field.values("velocity_x");
+  v3_[1] = (rank_ >= 2) ? (const cello_float *) field.values("velocity_y") : 0;
+  v3_[2] = (rank_ >= 3) ? (const cello_float *) field.values("velocity_z") : 0;
+
+  k3_[0] = 1;
+  k3_[1] = (rank_ >= 2) ? m3[0] : 0;
+  k3_[2] = (rank_ >= 3) ? m3[0]*m3[1] : 0;
+
+  return true;
+}
+
 //======================================================================
 
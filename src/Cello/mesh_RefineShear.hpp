@@ -29,7 +29,10 @@ public: // interface
 
   PUPable_decl(RefineShear);
 
-  RefineShear(CkMigrateMessage *m) : Refine (m) {}
+  RefineShear(CkMigrateMessage *m)
+    : Refine (m),
+      rank_(0)
+  {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -44,8 +47,40 @@ public: // interface
 
   virtual std::string name () const { return "shear"; };
 
+  virtual bool prepare (Block * block, int m3[3], int i3[3], int n3[3])
+    throw();
+
+  virtual int evaluate_cell (int i) const throw()
+  {
+    const cello_float shear = shear_(v3_[0],v3_[1],v3_[2],i,k3_,rank_);
+    return (shear > min_refine_)  ? adapt_refine :
+      (   (shear > max_coarsen_) ? adapt_same : adapt_coarsen);
+  }
+
 private: // functions
 
+  /// Inner-product of the shear vector at index i (works for rank 1,
+  /// 2 and 3)
+  template <class T>
+  inline T shear_ (const T * u, const T * v, const T * w,
+		   int i, const int k3[3], int rank) const
+  {
+    T uy = 0, vz = 0, wx = 0;
+    T uz = 0, vx = 0, wy = 0;
+    const int kx = k3[0], ky = k3[1], kz = k3[2];
+    if (rank >= 2) {
+      uy = u[i+ky] - u[i-ky]; uy *= uy;
+      vx = v[i+kx] - v[i-kx]; vx *= vx;
+    }
+    if (rank >= 3) {
+      uz = u[i+kz] - u[i-kz]; uz *= uz;
+      vz = v[i+kz] - v[i-kz]; vz *= vz;
+      wx = w[i+kx] - w[i-kx]; wx *= wx;
+      wy = w[i+ky] - w[i-ky]; wy *= wy;
+    }
+    return uy + uz + vx + vz + wx + wy;
+  }
+
   template <class T>
   void evaluate_block_(const T * u,
 		       const T * v,
@@ -57,6 +92,14 @@ private: // functions
 		       bool *any_refine,
 		       bool * all_coarsen, 
 		       int rank);
+
+private: // attributes
+
+  /// Velocity fields, index strides and rank of the Block set by
+  /// prepare() (not checkpointed)
+  const cello_float * v3_[3];
+  int k3_[3];
+  int rank_;
 };
 
 #endif /* MESH_REFINE_SHEAR_HPP */
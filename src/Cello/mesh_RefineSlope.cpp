@@ -15,7 +15,10 @@ RefineSlope::RefineSlope(double min_refine,
 			 int max_level,
 			 bool include_ghosts,
 			 std::string output) throw ()
-  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output)
+  : Refine (min_refine, max_coarsen, max_level, include_ghosts, output),
+    field_id_list_(),
+    arrays_(),
+    rank_(0)
 {
   FieldDescr * field_descr = cello::field_descr();
   if (field_name_list.size() != 0) {
@@ -56,6 +59,9 @@ int RefineSlope::apply ( Block * block ) throw ()
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // refinement is certain and no output field to complete
+    if (any_refine && ! output) break;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -123,29 +129,84 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
-	  if (output) {
-	    if (slope > max_coarsen_) output[i] =  0;
-	    if (slope > min_refine_)  output[i] = +1;
-	  }
+  // single sweep over the block, evaluating all axes at each cell
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	const T slope = slope_(array,i,d3,rank,h3);
+	if (slope > max_coarsen_) *all_coarsen = false;
+	if (slope > min_refine_) {
+	  *any_refine  = true;
+	  // result can no longer change
+	  if (! output) return;
+	}
+	if (output) {
+	  // output is shared by all fields, so only raise it
+	  if (slope > min_refine_)       output[i] = +1;
+	  else if (slope > max_coarsen_) output[i] = std::max(output[i],T(0));
 	}
       }
     }
   }
 }
-//======================================================================
+//----------------------------------------------------------------------
+
+bool RefineSlope::prepare
+(Block * block, int m3[3], int i3[3], int n3[3]) throw()
+{
+  if (has_output()) return false;
+
+  Field field = block->data()->field();
+
+  rank_ = cello::rank();
+
+  // all fields must be evaluated over the same cells
+  arrays_.clear();
+  for (size_t k=0; k<field_id_list_.size(); k++) {
+    const int id_field = field_id_list_[k];
+    if (field.precision(id_field) != default_precision) return false;
+    int mk3[3], gk3[3];
+    field.dimensions(id_field,&mk3[0],&mk3[1],&mk3[2]);
+    if (include_ghosts_) {
+      for (int i=0; i<3; i++) gk3[i] = (rank_ > i) ? 1 : 0;
+    } else {
+      field.ghost_depth(id_field,&gk3[0],&gk3[1],&gk3[2]);
+    }
+    for (int i=0; i<3; i++) {
+      if (k > 0 && (mk3[i] != m3[i] || gk3[i] != i3[i])) return false;
+      m3[i] = mk3[i];
+      i3[i] = gk3[i];
+      n3[i] = mk3[i] - 2*gk3[i];
+    }
+    arrays_.push_back((const cello_float *) field.values(id_field));
+  }
 
+  d3_[0] = 1;
+  d3_[1] = m3[0];
+  d3_[2] = m3[0]*m3[1];
+
+  Data * data = block->data();
+  double xm[3],xp[3];
+  data->lower(&xm[0],&xm[1],&xm[2]);
+  data->upper(&xp[0],&xp[1],&xp[2]);
+  for (int i=0; i<3; i++) field.cell_width(xm[i],xp[i],&h3_[i]);
+
+  return ! arrays_.empty();
+}
+
+//----------------------------------------------------------------------
+
+int RefineSlope::evaluate_cell (int i) const throw()
+{
+  int result = adapt_coarsen;
+  for (const cello_float * array : arrays_) {
+    const cello_float slope = slope_(array,i,d3_,rank_,h3_);
+    if (slope > min_refine_)  return adapt_refine;
+    if (slope > max_coarsen_) result = adapt_same;
+  }
+  return result;
+}
+
+//======================================================================
@@ -30,7 +30,12 @@ public: // interface
 
   PUPable_decl(RefineSlope);
 
-  RefineSlope(CkMigrateMessage *m) : Refine (m) {}
+  RefineSlope(CkMigrateMessage *m)
+    : Refine (m),
+      field_id_list_(),
+      arrays_(),
+      rank_(0)
+  {}
 
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
@@ -46,8 +51,28 @@ public: // interface
 
   virtual std::string name () const { return "slope"; };
 
+  virtual bool prepare (Block * block, int m3[3], int i3[3], int n3[3])
+    throw();
+
+  virtual int evaluate_cell (int i) const throw();
+
 private: // functions
 
+  /// Maximum over axes of the relative slope of array at index i
+  template <class T>
+  inline T slope_ (const T * array, int i, const int d3[3],
+		   int rank, const double * h3) const
+  {
+    const T tiny = 1e-10;
+    T slope = 0.0;
+    for (int axis=0; axis<rank; axis++) {
+      const int id = d3[axis];
+      T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
+      slope = std::max(slope,T(fabs( (array[i+id] - array[i-id]) / a)));
+    }
+    return slope;
+  }
+
   template <class T>
   void evaluate_block_(T * array,  T * output,
 		       int ndx, int ndy, int ndz,
@@ -62,6 +87,13 @@ private: // attributes
   /// List of field id's
   std::vector <int> field_id_list_;
 
+  /// Fields, index strides, cell widths and rank of the Block set by
+  /// prepare() (not checkpointed)
+  std::vector <const cello_float *> arrays_;
+  int d3_[3];
+  double h3_[3];
+  int rank_;
+
   
 };
 
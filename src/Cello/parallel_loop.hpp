@@ -0,0 +1,100 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parallel_loop.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parallel] Shared-memory loop parallelism within a Block
+///
+/// cello::parallel_for() splits the iterations of a loop across the
+/// threads available to the calling PE.  The threading backend is
+/// chosen when configuring the build using the CMake cache variable
+/// shared_memory_parallelism:
+///
+///   - "none" (default): loops are executed serially
+///   - "openmp": loops are split using an OpenMP parallel for, with
+///     the number of threads set by OMP_NUM_THREADS
+///   - "ckloop": loops are split using the Charm++ CkLoop library
+///     across the worker PEs of the node (requires SMP mode)
+///
+/// The loop body must be safe to call concurrently for different
+/// iterations: each iteration may only write to array elements that
+/// no other iteration reads or writes.
+
+#ifndef PARALLEL_LOOP_HPP
+#define PARALLEL_LOOP_HPP
+
+#if defined(CONFIG_USE_OPENMP)
+#  include <omp.h>
+#elif defined(CONFIG_USE_CKLOOP)
+#  include "CkLoopAPI.h"
+#endif
+
+namespace cello {
+
+  /// Return the number of threads that parallel_for() may use
+  inline int num_threads()
+  {
+#if defined(CONFIG_USE_OPENMP)
+    return omp_get_max_threads();
+#elif defined(CONFIG_USE_CKLOOP)
+    return CkMyNodeSize();
+#else
+    return 1;
+#endif
+  }
+
+#ifdef CONFIG_USE_CKLOOP
+  /// CkLoop helper function calling the loop body for the inclusive
+  /// iteration range [first,last]
+  template <class F>
+  void parallel_for_chunk_ (int first, int last, void * result,
+                            int num_param, void * param)
+  {
+    const F & body = *((const F *) param);
+    for (int i=first; i<=last; i++) body(i);
+  }
+#endif
+
+  /// Call body(i) for all i in [begin,end), splitting the iterations
+  /// across the available threads.  Returns when all iterations are
+  /// complete.
+  template <class F>
+  void parallel_for (int begin, int end, const F & body)
+  {
+    const int n = end - begin;
+    if (n <= 0) return;
+#if defined(CONFIG_USE_OPENMP)
+    if (n > 1 && ! omp_in_parallel()) {
+#     pragma omp parallel for schedule(static)
+      for (int i=begin; i<end; i++) body(i);
+      return;
+    }
+#elif defined(CONFIG_USE_CKLOOP)
+    const int num_chunks = std::min(n,CkMyNodeSize());
+    if (num_chunks > 1) {
+      CkLoop_Parallelize (parallel_for_chunk_<F>, 1, (void *) &body,
+                          num_chunks, begin, end - 1);
+      return;
+    }
+#endif
+    for (int i=begin; i<end; i++) body(i);
+  }
+
+  /// Call body(iz,iy) for all rows iz in [z_begin,z_end) and iy in
+  /// [y_begin,y_end), splitting the rows across the available threads.
+  /// Used instead of parallel_for() over iz alone so that 2D blocks
+  /// (which have a single iz) are also split.
+  template <class F>
+  void parallel_for_rows (int z_begin, int z_end,
+                          int y_begin, int y_end, const F & body)
+  {
+    const int ny = y_end - y_begin;
+    if (ny <= 0) return;
+    parallel_for
+      (0, (z_end - z_begin)*ny,
+       [&](int i) { body(z_begin + i / ny, y_begin + i % ny); });
+  }
+
+}
+
+#endif /* PARALLEL_LOOP_HPP */
@@ -71,7 +71,9 @@ void Config::pup (PUP::er &p)
   PUParray(p,field_ghost_depth,3);
   p | field_padding;
   p | field_history;
+  p | field_history_fields;
   p | field_precision;
+  p | field_group_precision;
   p | field_prolong;
   p | field_restrict;
   p | field_group_list;
@@ -86,6 +88,7 @@ void Config::pup (PUP::er &p)
 
   p | initial_restart;
   p | initial_restart_dir;
+  p | initial_restart_read_ahead;
 
   p | initial_trace_name;
   p | initial_trace_field;
@@ -99,6 +102,8 @@ void Config::pup (PUP::er &p)
   p | memory_active;
   p | memory_warning_mb;
   p | memory_limit_gb;
+  p | memory_sample_interval;
+  p | memory_sample_bytes;
 
   // Mesh
 
@@ -108,6 +113,7 @@ void Config::pup (PUP::er &p)
   p | mesh_min_level;
   p | mesh_max_level;
   p | mesh_max_initial_level;
+  p | mesh_refresh_aggregate;
   p | refined_regions_lower;
   p | refined_regions_upper;
 
@@ -118,6 +124,7 @@ void Config::pup (PUP::er &p)
   p | method_list;
   p | method_schedule_index;
   p | method_courant;
+  p | method_timestep_candidate;
   p | method_type;
 
   // Monitor
@@ -142,6 +149,8 @@ void Config::pup (PUP::er &p)
   p | output_image_color_particle_attribute;
   p | output_image_size;
   p | output_image_reduce_type;
+  p | output_image_reduce_arity;
+  p | output_image_reduce_precision;
   p | output_image_ghost;
   p | output_image_face_rank;
   p | output_image_min;
@@ -154,6 +163,10 @@ void Config::pup (PUP::er &p)
   p | output_dir_global;
   p | output_stride_write;
   p | output_stride_wait;
+  p | output_compress_level;
+  p | output_shuffle;
+  p | output_chunk_size;
+  p | output_truncate_bits;
   p | output_field_list;
   p | output_particle_list;
   p | output_checkpoint_file;
@@ -219,6 +232,7 @@ void Config::pup (PUP::er &p)
   p | stopping_time;
   p | stopping_seconds;
   p | stopping_interval;
+  p | stopping_subcycle;
 
   // Testing
 
@@ -577,17 +591,49 @@ void Config::read_field_ (Parameters * p) throw()
 
   field_history = p->value_integer("Field:history",0);
 
+  // fields or groups whose history is saved (default all)
+  field_history_fields.clear();
+  param = "Field:history_fields";
+  if (p->type(param) == parameter_list) {
+    const int n = p->list_length(param);
+    for (int i=0; i<n; i++) {
+      field_history_fields.push_back(p->list_value_string(i,param));
+    }
+  } else if (p->type(param) == parameter_string) {
+    field_history_fields.push_back(p->value_string(param));
+  }
+
   // Field precision
 
-  std::string precision_str = p->value_string("Field:precision","default");
+  auto precision_value = [](const std::string & precision_str) -> int
+    {
+      if      (precision_str == "default")   return precision_default;
+      else if (precision_str == "single")    return precision_single;
+      else if (precision_str == "double")    return precision_double;
+      else if (precision_str == "quadruple") return precision_quadruple;
+      ERROR1 ("Config::read()", "Unknown precision %s",
+              precision_str.c_str());
+      return precision_unknown;
+    };
 
-  if      (precision_str == "default")   field_precision = precision_default;
-  else if (precision_str == "single")    field_precision = precision_single;
-  else if (precision_str == "double")    field_precision = precision_double;
-  else if (precision_str == "quadruple") field_precision = precision_quadruple;
-  else {
-    ERROR1 ("Config::read()", "Unknown precision %s",
-	    precision_str.c_str());
+  field_precision = precision_value
+    (p->value_string("Field:precision","default"));
+
+  // Storage precision of field groups (Group : <group_name> : precision)
+
+  std::set<std::string> group_names;
+  for (int index_group = 0; index_group < num_groups; index_group++) {
+    group_names.insert(p->list_value_string(index_group, "Group:list"));
+  }
+  for (const auto & groups : field_group_list) {
+    group_names.insert(groups.begin(),groups.end());
+  }
+  field_group_precision.clear();
+  for (const std::string & group : group_names) {
+    param = std::string("Group:") + group + ":precision";
+    if (p->type(param) == parameter_string) {
+      field_group_precision[group] = precision_value(p->value_string(param));
+    }
   }
 
   field_prolong   = p->value_string ("Field:prolong","enzo");
@@ -623,6 +669,8 @@ void Config::read_initial_ (Parameters * p) throw()
 
   initial_restart      = p->value_logical ("Initial:restart",false);
   initial_restart_dir  = p->value_string  ("Initial:restart_dir","");
+  initial_restart_read_ahead =
+    p->value_integer ("Initial:restart_read_ahead",8);
 
   // InitialTrace
   initial_trace_name = p->value_string ("Initial:trace:name","trace");
@@ -644,6 +692,8 @@ void Config::read_memory_ (Parameters * p) throw()
   memory_active = p->value_logical("Memory:active",true);
   memory_warning_mb =  p->value_float("Memory:warning_mb",0.0);
   memory_limit_gb =    p->value_float("Memory:limit_gb",0.0);
+  memory_sample_interval = p->value_integer("Memory:sample_interval",0);
+  memory_sample_bytes    = p->value_integer("Memory:sample_bytes",0);
 }
 
 //----------------------------------------------------------------------
@@ -698,6 +748,10 @@ void Config::read_mesh_ (Parameters * p) throw()
 
   //--------------------------------------------------
 
+  mesh_refresh_aggregate = p->value_logical("Mesh:refresh_aggregate",false);
+
+  //--------------------------------------------------
+
   mesh_max_level = p->value_integer
     ("Adapt:max_level",0);
   mesh_max_initial_level = p->value_integer
@@ -834,6 +888,7 @@ void Config::read_method_ (Parameters * p) throw()
 
   method_list.   resize(num_method);
   method_courant.resize(num_method);
+  method_timestep_candidate.resize(num_method);
   method_schedule_index.resize(num_method);
   method_type.resize(num_method);
   
@@ -866,6 +921,10 @@ void Config::read_method_ (Parameters * p) throw()
     // Read courant condition if any
     method_courant[index_method] = p->value_float  (full_name + ":courant",1.0);
 
+    // Read whether to use timestep candidates computed by compute()
+    method_timestep_candidate[index_method] = p->value_logical
+      (full_name + ":timestep_candidate",false);
+
     method_type[index_method] = p->value_string
       (full_name + ":type", name);
   }
@@ -911,6 +970,8 @@ void Config::read_output_ (Parameters * p) throw()
   output_image_color_particle_attribute.resize(num_output);
   output_image_size.resize(num_output);
   output_image_reduce_type.resize(num_output);
+  output_image_reduce_arity.resize(num_output);
+  output_image_reduce_precision.resize(num_output);
   output_image_ghost.resize(num_output);
   output_image_face_rank.resize(num_output);
   output_image_min.resize(num_output);
@@ -922,6 +983,10 @@ void Config::read_output_ (Parameters * p) throw()
   output_dir.resize(num_output);
   output_stride_write.resize(num_output);
   output_stride_wait.resize(num_output);
+  output_compress_level.resize(num_output);
+  output_shuffle.resize(num_output);
+  output_chunk_size.resize(num_output);
+  output_truncate_bits.resize(num_output);
   output_field_list.resize(num_output);
   output_particle_list.resize(num_output);
   output_name.resize(num_output);
@@ -949,6 +1014,20 @@ void Config::read_output_ (Parameters * p) throw()
 
     output_stride_wait[index_output] = p->value_integer("stride_wait",0);
 
+    // HDF5 dataset layout and compression
+
+    output_compress_level[index_output] = p->value_integer("compress_level",0);
+    output_shuffle[index_output] = p->value_logical("shuffle",true);
+    output_chunk_size[index_output] = p->value_integer("chunk_size",0);
+    output_truncate_bits[index_output] = p->value_integer("truncate_bits",0);
+
+    ASSERT2("Config::read",
+            "Output:%s:compress_level %d must be between 0 and 9",
+            output_list[index_output].c_str(),
+            output_compress_level[index_output],
+            (0 <= output_compress_level[index_output] &&
+             output_compress_level[index_output] <= 9));
+
     if (p->type("dir") == parameter_string) {
       output_dir[index_output].resize(1);
       output_dir[index_output][0] = p->value_string("dir","");
@@ -1048,6 +1127,18 @@ void Config::read_output_ (Parameters * p) throw()
       output_image_reduce_type[index_output] = 
 	p->value_string("image_reduce_type","sum");
 
+      output_image_reduce_arity[index_output] = 
+	p->value_integer("image_reduce_arity",4);
+
+      output_image_reduce_precision[index_output] = 
+	p->value_string("image_reduce_precision","double");
+
+      ASSERT1 ("Config::read_output()",
+	       "image_reduce_precision \"%s\" must be \"single\" or \"double\"",
+	       output_image_reduce_precision[index_output].c_str(),
+	       (output_image_reduce_precision[index_output] == "single" ||
+		output_image_reduce_precision[index_output] == "double"));
+
       output_image_face_rank[index_output] = 
 	p->value_integer("image_face_rank",3);
 
@@ -1505,6 +1596,14 @@ void Config::read_stopping_ (Parameters * p) throw()
   }
 
   stopping_interval = p->value_integer ( "Stopping:interval" , 1);
+
+  stopping_subcycle = p->value_logical ( "Stopping:subcycle" , false);
+
+  // refreshed fields must also be in Field:history_fields if given,
+  // which is checked once all fields are defined (cello::finalize_fields())
+  ASSERT ("Config::read_stopping_()",
+          "Stopping:subcycle requires Field:history >= 1",
+          (! stopping_subcycle) || (field_history >= 1));
 }
 
 void Config::read_units_ (Parameters * p) throw()
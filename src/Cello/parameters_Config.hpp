@@ -52,7 +52,9 @@ public: // interface
     field_alignment(0),
     field_padding(0),
     field_history(0),
+    field_history_fields(),
     field_precision(0),
+    field_group_precision(),
     field_prolong(""),
     field_restrict(""),
     field_group_list(),
@@ -63,6 +65,7 @@ public: // interface
     initial_time(0.0),
     initial_restart(false),
     initial_restart_dir(""),
+    initial_restart_read_ahead(0),
     initial_trace_name(""),
     initial_trace_field(""),
     initial_trace_mpp(0.0),
@@ -72,10 +75,13 @@ public: // interface
     memory_active(false),
     memory_warning_mb(0.0),
     memory_limit_gb(0.0),
+    memory_sample_interval(0),
+    memory_sample_bytes(0),
     mesh_root_rank(0),
     mesh_min_level(0),
     mesh_max_level(0),
     mesh_max_initial_level(0),
+    mesh_refresh_aggregate(false),
     refined_regions_lower(),
     refined_regions_upper(),
     num_method(0),
@@ -83,6 +89,7 @@ public: // interface
     method_list(),
     method_schedule_index(),
     method_courant(),
+    method_timestep_candidate(),
     method_type(),
     monitor_debug(false),
     monitor_verbose(false),
@@ -101,6 +108,8 @@ public: // interface
     output_image_color_particle_attribute(),
     output_image_size(),
     output_image_reduce_type(),
+    output_image_reduce_arity(),
+    output_image_reduce_precision(),
     output_image_ghost(),
     output_image_face_rank(),
     output_image_min(),
@@ -112,6 +121,10 @@ public: // interface
     output_dir(),
     output_stride_write(),
     output_stride_wait(),
+    output_compress_level(),
+    output_shuffle(),
+    output_chunk_size(),
+    output_truncate_bits(),
     output_field_list(),
     output_particle_list(),
     output_name(),
@@ -159,6 +172,7 @@ public: // interface
     stopping_time(0.0),
     stopping_seconds(0.0),
     stopping_interval(0),
+    stopping_subcycle(false),
     units_mass(1.0),
     units_density(1.0),
     units_length(1.0),
@@ -204,7 +218,9 @@ public: // interface
       field_alignment(0),
       field_padding(0),
       field_history(0),
+      field_history_fields(),
       field_precision(0),
+      field_group_precision(),
       field_prolong(""),
       field_restrict(""),
       field_group_list(),
@@ -215,6 +231,7 @@ public: // interface
       initial_time(0.0),
       initial_restart(false),
       initial_restart_dir(""),
+      initial_restart_read_ahead(0),
       initial_trace_name(""),
       initial_trace_field(""),
       initial_trace_mpp(0.0),
@@ -224,10 +241,13 @@ public: // interface
       memory_active(false),
       memory_warning_mb(0.0),
       memory_limit_gb(0.0),
+      memory_sample_interval(0),
+      memory_sample_bytes(0),
       mesh_root_rank(0),
       mesh_min_level(0),
       mesh_max_level(0),
       mesh_max_initial_level(0),
+      mesh_refresh_aggregate(false),
       refined_regions_lower(),
       refined_regions_upper(),
       num_method(0),
@@ -235,6 +255,7 @@ public: // interface
       method_list(),
       method_schedule_index(),
       method_courant(),
+      method_timestep_candidate(),
       method_type(),
       monitor_debug(false),
       monitor_verbose(false),
@@ -253,6 +274,8 @@ public: // interface
       output_image_color_particle_attribute(),
       output_image_size(),
       output_image_reduce_type(),
+      output_image_reduce_arity(),
+      output_image_reduce_precision(),
       output_image_ghost(),
       output_image_face_rank(),
       output_image_min(),
@@ -264,6 +287,10 @@ public: // interface
       output_dir(),
       output_stride_write(),
       output_stride_wait(),
+      output_compress_level(),
+      output_shuffle(),
+      output_chunk_size(),
+      output_truncate_bits(),
       output_field_list(),
       output_particle_list(),
       output_name(),
@@ -311,6 +338,7 @@ public: // interface
       stopping_time(0.0),
       stopping_seconds(0.0),
       stopping_interval(0),
+      stopping_subcycle(false),
       // Units
       units_mass(1.0),
       units_density(1.0),
@@ -388,7 +416,9 @@ public: // attributes
   int                        field_ghost_depth[3];
   int                        field_padding;
   int                        field_history;
+  std::vector<std::string>   field_history_fields;
   int                        field_precision;
+  std::map<std::string,int>  field_group_precision;
   std::string                field_prolong;
   std::string                field_restrict;
   std::vector< std::vector<std::string> >  field_group_list;
@@ -404,6 +434,7 @@ public: // attributes
   /// restart
   bool                       initial_restart;
   std::string                initial_restart_dir;
+  int                        initial_restart_read_ahead;
 
   // InitialTrace
   std::string                initial_trace_name;
@@ -418,6 +449,8 @@ public: // attributes
   bool                       memory_active;
   double                     memory_warning_mb;
   double                     memory_limit_gb;
+  int                        memory_sample_interval;
+  int                        memory_sample_bytes;
 
   // Mesh
 
@@ -427,6 +460,7 @@ public: // attributes
   int                        mesh_min_level;
   int                        mesh_max_level;
   int                        mesh_max_initial_level;
+  bool                       mesh_refresh_aggregate;
   std::vector< std::vector<int> > refined_regions_lower;
   std::vector< std::vector<int> > refined_regions_upper;
 
@@ -437,6 +471,7 @@ public: // attributes
   std::vector<std::string>   method_list;
   std::vector<int>           method_schedule_index;
   std::vector<double>        method_courant;
+  std::vector<int>           method_timestep_candidate;
   std::vector<std::string>   method_type;
 
 
@@ -462,6 +497,8 @@ public: // attributes
   std::vector < std::string > output_image_color_particle_attribute;
   std::vector < std::vector <int> > output_image_size;
   std::vector < std::string>  output_image_reduce_type;
+  std::vector < int >         output_image_reduce_arity;
+  std::vector < std::string>  output_image_reduce_precision;
   std::vector < char>         output_image_ghost;
   std::vector < int >         output_image_face_rank;
   std::vector < double>       output_image_min;
@@ -474,6 +511,10 @@ public: // attributes
   std::string                 output_dir_global;
   std::vector < int >         output_stride_write;
   std::vector < int >         output_stride_wait;
+  std::vector < int >         output_compress_level;
+  std::vector < char >        output_shuffle;
+  std::vector < int >         output_chunk_size;
+  std::vector < int >         output_truncate_bits;
   std::vector < std::vector <std::string> >  output_field_list;
   std::vector < std::vector <std::string> > output_particle_list;
   std::vector < std::vector <std::string> >  output_name;
@@ -542,6 +583,7 @@ public: // attributes
   double                     stopping_time;
   double                     stopping_seconds;
   int                        stopping_interval;
+  bool                       stopping_subcycle;
 
   /// Units
 
@@ -59,7 +59,8 @@ public: // interface
   /// Initialize a Param object
   Param () 
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      value_code_(nullptr)
   {};
 
   /// Delete a Param object
@@ -69,7 +70,8 @@ public: // interface
   /// Copy constructor
   Param(const Param & param) throw()
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      value_code_(nullptr)
   { INCOMPLETE("Param::Param"); };
 
   /// Assignment operator
@@ -87,8 +89,7 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0 );
+    double             t);
 
   /// Evaluate a logical expression given vectos x,y,z,t
   void evaluate_logical  
@@ -97,8 +98,11 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0);
+    double             t);
+
+  /// Return the compiled floating-point or logical expression
+  const ParamExpr * expr ()
+  { value_accessed_ = true; return value_code_; }
 
   /// Set the parameter type and value
   void set(struct param_struct * param);
@@ -195,6 +199,7 @@ private: // functions
   { 
     type_ = parameter_float_expr;
     value_expr_     = value; 
+    value_code_     = new ParamExpr(value,false);
   };
 
   /// Set a logical expression parameter
@@ -202,6 +207,7 @@ private: // functions
   { 
     type_ = parameter_logical_expr;
     value_expr_     = value; 
+    value_code_     = new ParamExpr(value,true);
   };
 
   /// Deallocate the parameter
@@ -242,6 +248,10 @@ private: // attributes
     struct node_expr * value_expr_;
   };
 
+  /// Compiled expression if type_ is a floating-point or logical
+  /// expression
+  ParamExpr * value_code_;
+
 };
 
 //----------------------------------------------------------------------
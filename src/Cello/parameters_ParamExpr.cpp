@@ -0,0 +1,442 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamExpr.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implementation of the ParamExpr class
+
+#include "cello.hpp"
+
+#include "parameters.hpp"
+
+//----------------------------------------------------------------------
+
+ParamExpr::ParamExpr (const struct node_expr * node, bool is_logical)
+  : code_(),
+    num_registers_(0),
+    variables_(0),
+    result_()
+{
+  ASSERT("ParamExpr::ParamExpr()",
+         "expression is NULL", (node != NULL));
+
+  result_ = compile_(node,0,is_logical);
+
+  // record which coordinates are used so they are only gathered if needed
+
+  for (size_t i=0; i<code_.size(); i++) {
+    const Operand * operand[2] = { &code_[i].a, &code_[i].b };
+    for (int k=0; k<2; k++) {
+      if (operand[k]->kind == operand_x) variables_ |= 1;
+      if (operand[k]->kind == operand_y) variables_ |= 2;
+      if (operand[k]->kind == operand_z) variables_ |= 4;
+    }
+  }
+  if (result_.kind == operand_x) variables_ |= 1;
+  if (result_.kind == operand_y) variables_ |= 2;
+  if (result_.kind == operand_z) variables_ |= 4;
+}
+
+//----------------------------------------------------------------------
+
+int ParamExpr::registers_needed_ (const struct node_expr * node) const
+{
+  if (node == NULL) return 0;
+
+  int need = 0;
+  if (node->type == enum_node_function) {
+    need = std::max(1,registers_needed_(node->left));
+  } else if (node->type == enum_node_operation) {
+    const int nl = registers_needed_(node->left);
+    const int nr = registers_needed_(node->right);
+    need = std::max(1, (nl == nr) ? nl + 1 : std::max(nl,nr));
+  }
+  return need;
+}
+
+//----------------------------------------------------------------------
+
+ParamExpr::Operand ParamExpr::compile_
+(const struct node_expr * node, int base, bool is_logical)
+{
+  Operand operand;
+
+  switch (node->type) {
+
+  case enum_node_float:
+
+    operand.value = node->float_value;
+    break;
+
+  case enum_node_integer:
+
+    operand.value = double(node->integer_value);
+    break;
+
+  case enum_node_variable:
+
+    switch (node->var_value) {
+    case 'x': operand.kind = operand_x; break;
+    case 'y': operand.kind = operand_y; break;
+    case 'z': operand.kind = operand_z; break;
+    case 't': operand.kind = operand_t; break;
+    default:
+      ERROR1("ParamExpr::compile_()",
+             "unknown variable %c in expression",
+             node->var_value);
+      break;
+    }
+    break;
+
+  case enum_node_function:
+    {
+      ASSERT1("ParamExpr::compile_()",
+              "Error in function %s: missing argument",
+              node->function_name,
+              (node->left != NULL));
+
+      const Operand a = compile_(node->left,base,false);
+
+      if (a.kind == operand_constant) {
+        operand.value = (*(node->fun_value))(a.value);
+      } else {
+        Instruction instruction;
+        instruction.op       = op_function;
+        instruction.dst      = base;
+        instruction.a        = a;
+        instruction.function = node->fun_value;
+        code_.push_back(instruction);
+        operand.kind  = operand_register;
+        operand.index = base;
+      }
+    }
+    break;
+
+  case enum_node_operation:
+    {
+      // op_code ordering matches enum_op
+      const int op = node->op_value;
+
+      ASSERT3("ParamExpr::compile_()",
+              "Error in operation %d: left %p right %p",
+              op,node->left,node->right,
+              ((node->left != NULL) && (node->right != NULL)));
+
+      const bool is_compare = (op_le <= op && op <= op_ne);
+      const bool is_and_or  = (op == op_and || op == op_or);
+
+      if ((is_compare || is_and_or) && ! is_logical) {
+        ERROR1("ParamExpr::compile_()",
+               "logical operator %d in floating-point expression",
+               op);
+      }
+
+      // operands of comparisons are floating-point, and operands of
+      // "&&" and "||" are logical
+
+      const bool is_logical_child = is_and_or;
+
+      // evaluate the subtree needing more registers first so that the
+      // other only needs one more
+
+      Operand a,b;
+      if (registers_needed_(node->left) >= registers_needed_(node->right)) {
+        a = compile_(node->left, base,is_logical_child);
+        b = compile_(node->right,base + (a.kind == operand_register),
+                     is_logical_child);
+      } else {
+        b = compile_(node->right,base,is_logical_child);
+        a = compile_(node->left, base + (b.kind == operand_register),
+                     is_logical_child);
+      }
+
+      if (a.kind == operand_constant && b.kind == operand_constant) {
+        operand.value = apply_(op,a.value,b.value);
+      } else {
+        Instruction instruction;
+        instruction.op       = op;
+        instruction.dst      = base;
+        instruction.a        = a;
+        instruction.b        = b;
+        instruction.function = NULL;
+        code_.push_back(instruction);
+        operand.kind  = operand_register;
+        operand.index = base;
+      }
+    }
+    break;
+
+  case enum_node_unknown:
+  default:
+    ERROR1("ParamExpr::compile_()",
+           "unknown expression type %d",
+           node->type);
+    break;
+  }
+
+  if (operand.kind == operand_register) {
+    ASSERT2("ParamExpr::compile_()",
+            "Expression requires more than %d registers (%d)",
+            PARAM_EXPR_MAX_REGISTERS, base + 1,
+            (base < PARAM_EXPR_MAX_REGISTERS));
+    num_registers_ = std::max(num_registers_,base + 1);
+  }
+
+  return operand;
+}
+
+//----------------------------------------------------------------------
+
+double ParamExpr::apply_ (int op, double a, double b)
+{
+  switch (op) {
+  case op_add: return a + b;
+  case op_sub: return a - b;
+  case op_mul: return a * b;
+  case op_div: return a / b;
+  case op_pow: return pow(a,b);
+  case op_le:  return (a <= b) ? 1.0 : 0.0;
+  case op_lt:  return (a <  b) ? 1.0 : 0.0;
+  case op_ge:  return (a >= b) ? 1.0 : 0.0;
+  case op_gt:  return (a >  b) ? 1.0 : 0.0;
+  case op_eq:  return (a == b) ? 1.0 : 0.0;
+  case op_ne:  return (a != b) ? 1.0 : 0.0;
+  case op_and: return ((a != 0.0) && (b != 0.0)) ? 1.0 : 0.0;
+  case op_or:  return ((a != 0.0) || (b != 0.0)) ? 1.0 : 0.0;
+  default:
+    ERROR1("ParamExpr::apply_()",
+           "unknown operation %d", op);
+    return 0.0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Apply a binary operation to a tile, where either operand may be a
+/// scalar (null pointer)
+template <class OP>
+static inline void binary_
+(double * d, const double * a, double sa, const double * b, double sb,
+ int m, OP op)
+{
+  if (a && b) {
+    for (int i=0; i<m; i++) d[i] = op(a[i],b[i]);
+  } else if (a) {
+    for (int i=0; i<m; i++) d[i] = op(a[i],sb);
+  } else if (b) {
+    for (int i=0; i<m; i++) d[i] = op(sa,b[i]);
+  } else {
+    const double v = op(sa,sb);
+    for (int i=0; i<m; i++) d[i] = v;
+  }
+}
+
+//----------------------------------------------------------------------
+
+const double * ParamExpr::execute_
+(int m, const double * xt, const double * yt, const double * zt,
+ double t, double (*reg)[PARAM_EXPR_TILE], double * scalar) const
+{
+  // Return a pointer to the operand's values, or nullptr and the value
+  // in *s if it is a scalar
+
+  auto resolve = [&] (const Operand & operand, double * s) -> const double *
+    {
+      *s = 0.0;
+      switch (operand.kind) {
+      case operand_register: return reg[operand.index];
+      case operand_x:        return xt;
+      case operand_y:        return yt;
+      case operand_z:        return zt;
+      case operand_t:        *s = t; return nullptr;
+      default:               *s = operand.value; return nullptr;
+      }
+    };
+
+  for (size_t k=0; k<code_.size(); k++) {
+
+    const Instruction & instruction = code_[k];
+    double * d = reg[instruction.dst];
+    double sa,sb;
+    const double * a = resolve(instruction.a,&sa);
+
+    if (instruction.op == op_function) {
+      double (*f)(double) = instruction.function;
+      if (a) {
+        for (int i=0; i<m; i++) d[i] = (*f)(a[i]);
+      } else {
+        const double v = (*f)(sa);
+        for (int i=0; i<m; i++) d[i] = v;
+      }
+      continue;
+    }
+
+    const double * b = resolve(instruction.b,&sb);
+
+    switch (instruction.op) {
+    case op_add:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return p + q; });
+      break;
+    case op_sub:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return p - q; });
+      break;
+    case op_mul:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return p * q; });
+      break;
+    case op_div:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return p / q; });
+      break;
+    case op_pow:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return pow(p,q); });
+      break;
+    case op_le:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p <= q); });
+      break;
+    case op_lt:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p <  q); });
+      break;
+    case op_ge:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p >= q); });
+      break;
+    case op_gt:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p >  q); });
+      break;
+    case op_eq:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p == q); });
+      break;
+    case op_ne:
+      binary_(d,a,sa,b,sb,m,[](double p, double q) { return double(p != q); });
+      break;
+    case op_and:
+      binary_(d,a,sa,b,sb,m,[](double p, double q)
+              { return double((p != 0.0) && (q != 0.0)); });
+      break;
+    case op_or:
+      binary_(d,a,sa,b,sb,m,[](double p, double q)
+              { return double((p != 0.0) || (q != 0.0)); });
+      break;
+    default:
+      ERROR1("ParamExpr::execute_()",
+             "unknown operation %d", instruction.op);
+      break;
+    }
+  }
+
+  return resolve(result_,scalar);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ParamExpr::evaluate
+(T * result, int n,
+ const double * x, const double * y, const double * z,
+ double t) const
+{
+  double reg[PARAM_EXPR_MAX_REGISTERS][PARAM_EXPR_TILE];
+
+  for (int i0=0; i0<n; i0+=PARAM_EXPR_TILE) {
+    const int m = std::min(PARAM_EXPR_TILE,n-i0);
+    double s;
+    const double * r = execute_
+      (m, x ? x+i0 : nullptr, y ? y+i0 : nullptr, z ? z+i0 : nullptr,
+       t, reg, &s);
+    if (r) {
+      for (int i=0; i<m; i++) result[i0+i] = (T) r[i];
+    } else {
+      for (int i=0; i<m; i++) result[i0+i] = (T) s;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ParamExpr::evaluate
+(T * value, double t,
+ int ndx, int nx, const double * x,
+ int ndy, int ny, const double * y,
+ int ndz, int nz, const double * z,
+ const bool * mask) const
+{
+  double reg[PARAM_EXPR_MAX_REGISTERS][PARAM_EXPR_TILE];
+  double xt[PARAM_EXPR_TILE];
+  double yt[PARAM_EXPR_TILE];
+  double zt[PARAM_EXPR_TILE];
+
+  const bool use_x = (variables_ & 1) && x;
+  const bool use_y = (variables_ & 2) && y;
+  const bool use_z = (variables_ & 4) && z;
+
+  const int n = nx*ny*nz;
+
+  // grid indices of the first point in the current tile
+  int ix0=0, iy0=0, iz0=0;
+
+  for (int i0=0; i0<n; i0+=PARAM_EXPR_TILE) {
+
+    const int m = std::min(PARAM_EXPR_TILE,n-i0);
+
+    // gather coordinates for the tile
+
+    int ix=ix0, iy=iy0, iz=iz0;
+    if (use_x || use_y || use_z) {
+      for (int i=0; i<m; i++) {
+        if (use_x) xt[i] = x[ix];
+        if (use_y) yt[i] = y[iy];
+        if (use_z) zt[i] = z[iz];
+        if (++ix == nx) { ix=0; if (++iy == ny) { iy=0; ++iz; } }
+      }
+    }
+
+    double s;
+    const double * r = execute_
+      (m, use_x ? xt : nullptr, use_y ? yt : nullptr, use_z ? zt : nullptr,
+       t, reg, &s);
+
+    // scatter results to the strided output array
+
+    ix=ix0; iy=iy0; iz=iz0;
+    for (int i=0; i<m; i++) {
+      if (!mask || mask[i0+i]) {
+        value[ix + ndx*(iy + ndy*iz)] = (T) (r ? r[i] : s);
+      }
+      if (++ix == nx) { ix=0; if (++iy == ny) { iy=0; ++iz; } }
+    }
+    ix0=ix; iy0=iy; iz0=iz;
+  }
+}
+
+//----------------------------------------------------------------------
+
+template void ParamExpr::evaluate
+(double * result, int n,
+ const double * x, const double * y, const double * z, double t) const;
+template void ParamExpr::evaluate
+(bool * result, int n,
+ const double * x, const double * y, const double * z, double t) const;
+
+template void ParamExpr::evaluate
+(float * value, double t,
+ int ndx, int nx, const double * x,
+ int ndy, int ny, const double * y,
+ int ndz, int nz, const double * z,
+ const bool * mask) const;
+template void ParamExpr::evaluate
+(double * value, double t,
+ int ndx, int nx, const double * x,
+ int ndy, int ny, const double * y,
+ int ndz, int nz, const double * z,
+ const bool * mask) const;
+template void ParamExpr::evaluate
+(long double * value, double t,
+ int ndx, int nx, const double * x,
+ int ndy, int ny, const double * y,
+ int ndz, int nz, const double * z,
+ const bool * mask) const;
+template void ParamExpr::evaluate
+(bool * value, double t,
+ int ndx, int nx, const double * x,
+ int ndy, int ny, const double * y,
+ int ndz, int nz, const double * z,
+ const bool * mask) const;
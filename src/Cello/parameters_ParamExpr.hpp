@@ -0,0 +1,147 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamExpr.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Parameters] Declaration of the ParamExpr class
+
+#ifndef PARAMETERS_PARAM_EXPR_HPP
+#define PARAMETERS_PARAM_EXPR_HPP
+
+/// @def      PARAM_EXPR_TILE
+/// @brief    Number of points evaluated at a time by ParamExpr
+#define PARAM_EXPR_TILE 128
+
+/// @def      PARAM_EXPR_MAX_REGISTERS
+/// @brief    Maximum number of tile registers used by a ParamExpr
+#define PARAM_EXPR_MAX_REGISTERS 16
+
+class ParamExpr {
+
+  /// @class    ParamExpr
+  /// @ingroup  Parameters
+  /// @brief    [\ref Parameters] Compiled floating-point or logical
+  /// expression
+  ///
+  /// A ParamExpr is compiled once from a parsed expression tree into
+  /// a flat list of register instructions, with subexpressions that
+  /// do not depend on x, y, z, or t folded into constants.  The code
+  /// is evaluated in tiles of PARAM_EXPR_TILE points using registers
+  /// on the stack, so evaluation does no heap allocation.  Logical
+  /// values are represented as 0.0 (false) or 1.0 (true).
+
+public: // interface
+
+  /// Create an empty expression, which evaluates to 0
+  ParamExpr() throw()
+    : code_(),
+      num_registers_(0),
+      variables_(0),
+      result_()
+  { }
+
+  /// Compile the given expression tree
+  ParamExpr(const struct node_expr * node, bool is_logical);
+
+  /// Return whether the expression is independent of x, y, z, and t
+  bool is_constant() const throw()
+  { return result_.kind == operand_constant; }
+
+  /// Return the number of instructions in the compiled code
+  int num_instructions() const throw()
+  { return code_.size(); }
+
+  /// Return the number of tile registers required
+  int num_registers() const throw()
+  { return num_registers_; }
+
+  /// Evaluate the expression at n points (x[i],y[i],z[i]) at time t.
+  /// Null coordinate arrays are treated as 0.
+  template <class T>
+  void evaluate (T * result, int n,
+                 const double * x, const double * y, const double * z,
+                 double t) const;
+
+  /// Evaluate the expression at grid points (x[ix],y[iy],z[iz]) at
+  /// time t, storing results in the array value of size ndx*ndy*ndz.
+  /// If mask is given (size nx*ny*nz), only points where it is true
+  /// are stored.
+  template <class T>
+  void evaluate (T * value, double t,
+                 int ndx, int nx, const double * x,
+                 int ndy, int ny, const double * y,
+                 int ndz, int nz, const double * z,
+                 const bool * mask = nullptr) const;
+
+private: // types
+
+  /// Kinds of instruction operands
+  enum operand_kind {
+    operand_constant,
+    operand_register,
+    operand_x,
+    operand_y,
+    operand_z,
+    operand_t
+  };
+
+  /// Instruction operand: constant value, register, or variable
+  struct Operand {
+    Operand() : kind(operand_constant), index(0), value(0.0) { }
+    int    kind;
+    int    index;
+    double value;
+  };
+
+  /// Instruction codes
+  enum op_code {
+    op_add, op_sub, op_mul, op_div, op_pow,
+    op_le,  op_lt,  op_ge,  op_gt,  op_eq,  op_ne,
+    op_and, op_or,
+    op_function
+  };
+
+  /// Instruction: register[dst] = a OP b, or register[dst] = f(a)
+  struct Instruction {
+    int op;
+    int dst;
+    Operand a;
+    Operand b;
+    double (*function)(double);
+  };
+
+private: // functions
+
+  /// Return the number of registers needed to evaluate the subtree
+  int registers_needed_(const struct node_expr * node) const;
+
+  /// Compile the subtree using registers starting at base
+  Operand compile_(const struct node_expr * node, int base, bool is_logical);
+
+  /// Apply a binary operation to constants
+  static double apply_(int op, double a, double b);
+
+  /// Evaluate the code for m <= PARAM_EXPR_TILE points, returning
+  /// either a pointer to the m values or nullptr with *scalar set.
+  /// Null coordinate arrays are treated as 0.
+  const double * execute_
+  (int m, const double * xt, const double * yt, const double * zt,
+   double t, double (*reg)[PARAM_EXPR_TILE], double * scalar) const;
+
+private: // attributes
+
+  /// Compiled instructions
+  std::vector<Instruction> code_;
+
+  /// Number of tile registers needed
+  int num_registers_;
+
+  /// Bitmask of variables used: 1 for x, 2 for y, 4 for z
+  int variables_;
+
+  /// Operand holding the final result
+  Operand result_;
+
+};
+
+#endif /* PARAMETERS_PARAM_EXPR_HPP */
@@ -29,6 +29,15 @@ Performance::Performance (Config * config)
   region_started_(),
   region_index_(),
   region_in_charm_(),
+  region_memory_group_(),
+  region_stack_(),
+  timer_name_(),
+  timer_index_(),
+  timer_sum_(),
+  timer_count_(),
+  timer_min_(),
+  timer_max_(),
+  timer_memory_group_(),
 #ifdef CONFIG_USE_PAPI  
   papi_counters_(0),
 #endif
@@ -47,6 +56,9 @@ Performance::Performance (Config * config)
   new_counter(counter_type_abs,"bytes-high");
   new_counter(counter_type_abs,"bytes-highest");
   new_counter(counter_type_abs,"bytes-available");
+  // DISK: bytes stored and time spent in HDF5 dataset writes
+  new_counter(counter_type_user,"disk-bytes");
+  new_counter(counter_type_user,"disk-usec");
 
 #ifdef CONFIG_USE_PAPI  
   papi_.init();
@@ -205,6 +217,7 @@ Performance::new_region (int         region_index,
   if ((size_t)region_index >= region_name_.size()) {
     region_name_.resize(region_index+1);
     region_in_charm_.resize(region_index+1);
+    region_memory_group_.resize(region_index+1);
   }
 
   region_name_[region_index]    = region_name;
@@ -214,6 +227,10 @@ Performance::new_region (int         region_index,
   std::vector <long long> counters;
   region_counters_.push_back(counters);
   region_started_.push_back(false);
+
+  Memory * memory = Memory::instance();
+  region_memory_group_[region_index] =
+    memory ? memory->new_group(region_name) : 0;
 }
 
 //----------------------------------------------------------------------
@@ -252,6 +269,10 @@ Performance::start_region(int id_region, std::string file, int line) throw()
     return;
   }
 
+  // attribute sampled allocations to the region
+  region_stack_.push_back(index_region);
+  update_memory_group_();
+
   refresh_counters_();
     
   for (int i=0; i<num_counters(); i++) {
@@ -295,6 +316,16 @@ Performance::stop_region(int id_region, std::string file, int line) throw()
     return;
   }
 
+  // return sampled allocations to the enclosing region, which need
+  // not be the most recently started one
+  for (int i=region_stack_.size()-1; i>=0; i--) {
+    if (region_stack_[i] == index_region) {
+      region_stack_.erase(region_stack_.begin()+i);
+      break;
+    }
+  }
+  update_memory_group_();
+
   refresh_counters_();
 
   for (int i=0; i<num_counters(); i++) {
@@ -341,5 +372,106 @@ Performance::region_counters(int index_region, long long * counters) throw()
   }
 }
 
+//----------------------------------------------------------------------
+
+int
+Performance::new_timer (std::string timer_name) throw()
+{
+  auto it = timer_index_.find(timer_name);
+  if (it != timer_index_.end()) return it->second;
+
+  const int index_timer = timer_name_.size();
+  timer_name_.push_back(timer_name);
+  timer_index_[timer_name] = index_timer;
+  timer_sum_.push_back(0.0);
+  timer_count_.push_back(0);
+  timer_min_.push_back(std::numeric_limits<double>::max());
+  timer_max_.push_back(0.0);
+
+  Memory * memory = Memory::instance();
+  timer_memory_group_.push_back(memory ? memory->new_group(timer_name) : 0);
+
+  return index_timer;
+}
+
+//----------------------------------------------------------------------
+
+void Performance::new_memory_groups_() throw()
+{
+  Memory * memory = Memory::instance();
+  region_memory_group_.assign(region_name_.size(),0);
+  timer_memory_group_.assign(timer_name_.size(),0);
+  if (memory) {
+    for (size_t i=0; i<region_name_.size(); i++) {
+      if (region_name_[i] != "") {
+        region_memory_group_[i] = memory->new_group(region_name_[i]);
+      }
+    }
+    for (size_t i=0; i<timer_name_.size(); i++) {
+      timer_memory_group_[i] = memory->new_group(timer_name_[i]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Performance::update_memory_group_() throw()
+{
+  Memory * memory = Memory::instance();
+  if (memory && memory->is_sampling()) {
+    memory->set_group_index
+      (region_stack_.empty() ? 0 : region_memory_group_[region_stack_.back()]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int
+Performance::timer_index (std::string timer_name) const throw()
+{
+  auto it=timer_index_.find(timer_name);
+  return (it != timer_index_.end()) ? it->second : -1;
+}
+
+//----------------------------------------------------------------------
+
+void
+Performance::timer_accumulate (int index_timer, double time) throw()
+{
+  if (index_timer < 0 || index_timer >= num_timers()) return;
+  timer_sum_[index_timer] += time;
+  timer_count_[index_timer] ++;
+  timer_min_[index_timer] = std::min(timer_min_[index_timer],time);
+  timer_max_[index_timer] = std::max(timer_max_[index_timer],time);
+}
+
+//----------------------------------------------------------------------
+
+void
+Performance::timer_values
+(int index_timer,
+ long long * sum, long long * count,
+ long long * min, long long * max) const throw()
+{
+  const long long count_timer = timer_count_[index_timer];
+  *sum   = (long long)(1e6*timer_sum_[index_timer]);
+  *count = count_timer;
+  *min   = (count_timer > 0) ? (long long)(1e6*timer_min_[index_timer]) : 0;
+  *max   = (long long)(1e6*timer_max_[index_timer]);
+}
+
+//----------------------------------------------------------------------
+
+void
+Performance::clear_timers() throw()
+{
+  for (int i=0; i<num_timers(); i++) {
+    timer_sum_[i]   = 0.0;
+    timer_count_[i] = 0;
+    timer_min_[i]   = std::numeric_limits<double>::max();
+    timer_max_[i]   = 0.0;
+  }
+}
+
 //======================================================================
 
@@ -27,6 +27,8 @@ enum index_enum {
   perf_index_bytes_high,
   perf_index_bytes_highest,
   perf_index_bytes_available,
+  perf_index_disk_bytes,
+  perf_index_disk_usec,
   perf_index_last,
   num_perf_index = perf_index_last
 };
@@ -52,6 +54,8 @@ enum perf_region {
   perf_refresh_store_sync,
   perf_refresh_child_sync,
   perf_refresh_exit_sync,
+  perf_refresh_setup,
+  perf_refresh_load,
   perf_control,
   perf_compute,
   perf_output,
@@ -85,6 +89,15 @@ public: // interface
      region_started_(),
      region_index_(),
      region_in_charm_(),
+     region_memory_group_(),
+     region_stack_(),
+     timer_name_(),
+     timer_index_(),
+     timer_sum_(),
+     timer_count_(),
+     timer_min_(),
+     timer_max_(),
+     timer_memory_group_(),
 #ifdef CONFIG_USE_PAPI     
      papi_counters_(0),
 #endif
@@ -116,6 +129,13 @@ public: // interface
     p | region_started_;
     p | region_index_;
     p | region_in_charm_;
+    p | region_stack_;
+    p | timer_name_;
+    p | timer_index_;
+    p | timer_sum_;
+    p | timer_count_;
+    p | timer_min_;
+    p | timer_max_;
 #ifdef CONFIG_USE_PAPI  
     WARNING("Performance::pup",
 	    "skipping Performance:papi_counters_");
@@ -123,6 +143,7 @@ public: // interface
 #endif    
     p | warnings_;
     p | index_region_current_;
+    if (p.isUnpacking()) new_memory_groups_();
   }
 
   /// Begin collecting performance data
@@ -191,6 +212,38 @@ public: // interface
   bool region_started(int index_region) const throw()
   { return region_started_[index_region]; }
 
+  /// Add a new named timer for accumulating per-Block elapsed times
+  /// (e.g. for a Method or Solver), returning its index
+  int new_timer(std::string timer_name) throw();
+
+  /// Return the number of timers
+  int num_timers() const throw()
+  { return timer_name_.size(); }
+
+  /// Return the name of the given timer
+  std::string timer_name (int index_timer) const throw()
+  { return timer_name_[index_timer]; }
+
+  /// Return the index of the given timer, or -1 if not defined
+  int timer_index (std::string timer_name) const throw();
+
+  /// Add the elapsed time in seconds for one Block to the timer
+  void timer_accumulate(int index_timer, double time) throw();
+
+  /// Return the total, number of samples, and minimum and maximum
+  /// per-Block times in microseconds since timers were last cleared
+  void timer_values(int index_timer,
+                    long long * sum, long long * count,
+                    long long * min, long long * max) const throw();
+
+  /// Clear all timers, e.g. after performance output
+  void clear_timers() throw();
+
+  /// Return the Memory group to which allocations in the timed code
+  /// (e.g. Method::compute()) are attributed
+  int timer_memory_group (int index_timer) const throw()
+  { return timer_memory_group_[index_timer]; }
+
 #ifdef CONFIG_USE_PAPI  
   /// Return the associated Papi object
   Papi * papi() { return &papi_; };
@@ -201,6 +254,13 @@ private: // functions
   /// Refresh the array of current counter values
   void refresh_counters_() throw();
 
+  /// Define a Memory group for each region and timer, to which
+  /// sampled allocations are attributed
+  void new_memory_groups_() throw();
+
+  /// Attribute sampled allocations to the innermost started region
+  void update_memory_group_() throw();
+
   /// Return the current time in usec
   long long time_real_ () const
   {
@@ -246,6 +306,33 @@ private: // attributes
   /// which regions are outside scope of Cello
   std::vector<char> region_in_charm_;
 
+  /// Memory group index of each region
+  std::vector<int> region_memory_group_;
+
+  /// Started regions in the order they were started
+  std::vector<int> region_stack_;
+
+  /// list of timer names
+  std::vector<std::string> timer_name_;
+
+  /// mapping of timer name to index
+  std::map<std::string,int> timer_index_;
+
+  /// Accumulated per-Block times (seconds)
+  std::vector<double> timer_sum_;
+
+  /// Number of per-Block times accumulated
+  std::vector<long long> timer_count_;
+
+  /// Minimum per-Block time (seconds)
+  std::vector<double> timer_min_;
+
+  /// Maximum per-Block time (seconds)
+  std::vector<double> timer_max_;
+
+  /// Memory group index of each timer
+  std::vector<int> timer_memory_group_;
+
 #ifdef CONFIG_USE_PAPI  
   /// Array for storing PAPI counter values
   long long * papi_counters_;
@@ -58,6 +58,13 @@ public: // virtual functions
     const Hierarchy  * hierarchy
     ) throw();
 
+  /// Return whether the initializer can set the given field when it
+  /// is stored at other than the default precision; false unless
+  /// overridden (see Method::supports_field_precision())
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return false; }
+
 protected: // functions
 
 
@@ -61,6 +61,11 @@ public: // virtual functions
     const Hierarchy  * hierarchy
     ) throw();
 
+  /// Only the field weighting tracer placement is read
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return field_name != ((field_ == "") ? "density" : field_); }
+
 protected: // functions
 
   /// Initial particle positions are a uniform array if mpp_ == 0
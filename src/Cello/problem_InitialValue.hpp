@@ -46,6 +46,11 @@ public: // interface
                               const Hierarchy * hierarchy
                               ) throw();
 
+  /// Values are copied at each field's own precision
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
 private: // functions
 
   void copy_values_ (FieldData * field_data,
@@ -44,40 +44,6 @@ void MaskExpr::evaluate (bool * mask, double t,
 	  ndx,ndy,ndz,nx,ny,nz,
 	  (ndx >= nx) && (ndy >= ny) && (ndz >= nz));
 
-  bool * mask_temp = new bool [nx*ny*nz];
-  double * x = new double [nx*ny*nz];
-  double * y = (ndy > 1) ? new double [nx*ny*nz] : NULL;
-  double * z = (ndz > 1) ? new double [nx*ny*nz] : NULL;
-
-  for (int iz=0; iz<nz; iz++) {
-    for (int iy=0; iy<ny; iy++) {
-      for (int ix=0; ix<nx; ix++) {
-	int i=ix + nx*(iy + ny*iz);
-	x[i] = xv[ix];
-	if (y) y[i] = yv[iy];
-	if (z) z[i] = zv[iz];
-	mask_temp[i] = false;
-      }
-    }
-  }
-
-  int n=nx*ny*nz;
-
-  param_->evaluate_logical(n,mask_temp,x,y,z,t);
-
-  for (int iz=0; iz<nz; iz++) {
-    for (int iy=0; iy<ny; iy++) {
-      for (int ix=0; ix<nx; ix++) {
-	int i=ix + nx*(iy + ny*iz);
-	int id=ix + ndx*(iy + ndy*iz);
-	mask[id] = mask_temp[i];
-      }
-    }
-  }
-
-  delete [] z;
-  delete [] y;
-  delete [] x;
-  delete [] mask_temp;
-
+  param_->expr()->evaluate
+    (mask,t,ndx,nx,xv,ndy,ny,yv,ndz,nz,zv);
 }
@@ -14,7 +14,9 @@ double Method::courant_global = 1.0;
 Method::Method (double courant) throw()
   : schedule_(NULL),
     courant_(courant),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    index_timer_(-1),
+    is_timestep_candidate_(-1)
 {
   ir_post_ = add_refresh_();
   cello::refresh(ir_post_)->set_callback(CkIndex_Block::p_compute_continue());
@@ -37,6 +39,8 @@ void Method::pup (PUP::er &p)
   p | courant_;
   p | ir_post_;
   p | neighbor_type_;
+  p | index_timer_;
+  p | is_timestep_candidate_;
 
 }
 
@@ -72,3 +76,41 @@ void Method::set_schedule (Schedule * schedule) throw()
 }
 
 //======================================================================
+
+void Method::enable_timestep_candidate() throw()
+{
+  if (is_timestep_candidate_ < 0) {
+    is_timestep_candidate_ = cello::scalar_descr_double()->new_value
+      (name() + ":timestep_candidate",2);
+  }
+}
+
+//----------------------------------------------------------------------
+
+double Method::timestep_candidate (Block * block) throw()
+{
+  if (is_timestep_candidate_ >= 0) {
+    Scalar<double> scalar = block->data()->scalar_double();
+    const double * candidate = scalar.value(is_timestep_candidate_);
+    // Scalars of new Blocks are zero, and the time recorded differs
+    // from the Block's time if compute() was skipped since
+    if (candidate[0] > 0.0 && candidate[1] == block->time()) {
+      return candidate[0];
+    }
+  }
+  return timestep(block);
+}
+
+//----------------------------------------------------------------------
+
+void Method::set_timestep_candidate_ (Block * block, double dt) throw()
+{
+  if (is_timestep_candidate_ >= 0) {
+    Scalar<double> scalar = block->data()->scalar_double();
+    double * candidate = scalar.value(is_timestep_candidate_);
+    candidate[0] = dt;
+    candidate[1] = block->time() + block->dt();
+  }
+}
+
+//======================================================================
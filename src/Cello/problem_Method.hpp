@@ -33,7 +33,9 @@ public: // interface
     schedule_(NULL),
     courant_(1.0),
     ir_post_(-1),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    index_timer_(-1),
+    is_timestep_candidate_(-1)
 
   { }
 
@@ -63,6 +65,54 @@ public: // virtual functions
   virtual double timestep (Block * block) throw()
   { return std::numeric_limits<double>::max(); }
 
+  /// Return whether the method advances a Block by its own timestep
+  ///
+  /// When subcycling ("Stopping:subcycle"), such methods are only
+  /// applied to Blocks whose level begins a step in the current cycle.
+  /// Methods that communicate between Blocks (e.g. reductions) must be
+  /// applied to all Blocks, and should return false.
+  virtual bool is_subcycled () const throw()
+  { return true; }
+
+  /// Return whether the method may only be applied when all levels are
+  /// synchronized
+  ///
+  /// When subcycling, such methods are skipped on all Blocks in cycles
+  /// between synchronized steps.  Methods that contribute to reductions
+  /// over the Block array (e.g. load balancing or checkpointing), but that
+  /// do not advance Blocks in time, should return true.
+  virtual bool is_synchronized () const throw()
+  { return false; }
+
+  /// Return whether the method can access the given field when it is
+  /// stored at other than the default precision ("Group:<group>:precision")
+  ///
+  /// Most methods cast field values to enzo_float, so this is false
+  /// unless overridden.  Methods should return true only for fields
+  /// they do not access, or that they convert to and from the
+  /// precision they compute in (e.g. Field::values_to() and
+  /// Field::values_from()).
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Return whether compute() may modify the given field in the
+  /// Block's active zone
+  ///
+  /// This is true unless overridden.  It is used to decide whether
+  /// timestep candidates of earlier methods are still valid when this
+  /// method has been applied (see timestep_fields()).
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Return the fields from which timestep candidates are computed
+  ///
+  /// A timestep candidate is only used if no later method in the list
+  /// modifies any of these fields (see modifies_field()).
+  virtual std::vector<std::string> timestep_fields () const throw()
+  { return std::vector<std::string>(); }
+
   /// Resume computation after a reduction
   ///
   /// This member function only typically needs to be implemented by Method
@@ -93,8 +143,34 @@ public: // virtual functions
   void set_courant(double courant) throw ()
   { courant_ = courant; }
 
+  /// Set the index of the Performance timer for this Method
+  void set_index_timer(int index_timer) throw ()
+  { index_timer_ = index_timer; }
+
+  /// Return the index of the Performance timer for this Method
+  int index_timer() const throw ()
+  { return index_timer_; }
+
+  /// Record timestep candidates computed as a by-product of compute()
+  /// (see "Method:<method>:timestep_candidate")
+  void enable_timestep_candidate() throw();
+
+  /// Return whether timestep candidates are recorded
+  bool timestep_candidate_enabled() const throw ()
+  { return is_timestep_candidate_ >= 0; }
+
+  /// Return the timestep candidate recorded by the last compute() on
+  /// the Block if it is still valid, that is if the Block has not been
+  /// created or its time reset since, otherwise return timestep()
+  double timestep_candidate (Block * block) throw();
+
 protected: // functions
 
+  /// Record dt as the Block's timestep for the step following the
+  /// current one; called by Methods at the end of compute() if
+  /// timestep_candidate_enabled().  dt includes the courant factor.
+  void set_timestep_candidate_ (Block * block, double dt) throw();
+
   /// Perform vector copy X <- Y
   template <class T>
   void copy_ (T * X, const T * Y,
@@ -124,6 +200,13 @@ protected: // attributes
   /// Default refresh type
   int neighbor_type_;
 
+  /// Index of the Performance timer for per-Block compute() times
+  int index_timer_;
+
+  /// Index of the Block double Scalars holding the timestep candidate
+  /// and the Block time it is valid for, or -1 if not recorded
+  int is_timestep_candidate_;
+
 };
 
 #endif /* PROBLEM_METHOD_HPP */
@@ -46,6 +46,16 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "close_files"; }
 
+  /// Does not access fields
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
 private: // functions
 
   void throttle_stagger_();
@@ -67,6 +67,11 @@ public: // virtual functions
   /// Return the name of this MethodDebug
   virtual std::string name () throw () { return "debug"; }
 
+  /// Communicates between Blocks, so is applied to all Blocks when
+  /// subcycling
+  virtual bool is_subcycled () const throw()
+  { return false; }
+
 protected: // attributes
 
   int num_fields_;
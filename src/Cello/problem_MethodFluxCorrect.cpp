@@ -123,6 +123,23 @@ void MethodFluxCorrect::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+bool MethodFluxCorrect::supports_field_precision
+(const std::string & field_name) const throw()
+{
+  return (field_name != "density") &&
+    ! cello::field_groups()->is_in(field_name, group_);
+}
+
+//----------------------------------------------------------------------
+
+bool MethodFluxCorrect::modifies_field
+(const std::string & field_name) const throw()
+{
+  return ! supports_field_precision(field_name);
+}
+
+//----------------------------------------------------------------------
+
 void Block::p_method_flux_correct_refresh()
 {
   static_cast<MethodFluxCorrect*>
@@ -262,7 +279,12 @@ void MethodFluxCorrect::compute_continue_sum_fields
     }
   }
 
-  block->data()->flux_data()->deallocate();
+  // When subcycling, keep fluxes until the end of the Block's step so
+  // that fluxes from finer neighbors accumulate over their substeps
+
+  if (block->subcycle_closing()) {
+    block->data()->flux_data()->deallocate();
+  }
 
   block->compute_done();
 }
@@ -430,8 +452,9 @@ void MethodFluxCorrect::flux_correct_(Block * block)
   FluxData * flux_data = block->data()->flux_data();
   const int nf = flux_data->num_fields();
 
-  // Perform flux-correction
-  if (enable_ && block->is_leaf()) {
+  // Perform flux-correction (at the end of the Block's step if
+  // subcycling)
+  if (enable_ && block->is_leaf() && block->subcycle_closing()) {
     if (nf  == 0){
       return;
     }
@@ -65,6 +65,19 @@ public: // virtual functions
   virtual std::string name () throw ()
   { return "flux_correct"; }
 
+  /// Corrected fields and density are accessed as cello_float
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw();
+
+  /// Only the corrected fields and density are modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw();
+
+  /// Applied to all Blocks when subcycling, correcting Blocks at the
+  /// end of their step
+  virtual bool is_subcycled () const throw()
+  { return false; }
+
 protected: // functions
 
   void flux_correct_ (Block * block);
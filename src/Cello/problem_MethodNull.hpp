@@ -55,6 +55,16 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "null"; }
 
+  /// Does not access fields
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw()
   { return dt_; }
@@ -22,13 +22,30 @@
 
 //----------------------------------------------------------------------
 
-MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
+MethodOrderHilbert::MethodOrderHilbert(ParameterGroup p, int min_level) throw ()
   : Method(),
     is_index_(-1),
     is_weight_(-1),
     is_weight_child_(-1),
-    min_level_(min_level)
+    min_level_(min_level),
+    is_cost_(-1),
+    is_cost_child_(-1),
+    is_cost_index_(-1),
+    is_cost_count_(-1),
+    cost_type_(p.value_string("cost","block")),
+    cost_value_(nullptr)
 {
+  ASSERT1 ("MethodOrderHilbert::MethodOrderHilbert()",
+           "Unknown cost type \"%s\"",
+           cost_type_.c_str(),
+           (cost_type_ == "block" || cost_type_ == "particles" ||
+            cost_type_ == "time"  || cost_type_ == "value"));
+
+  if (cost_type_ == "value") {
+    cost_value_ = new Value (cello::simulation()->parameters(),
+                             p.full_name("cost_value"));
+  }
+
   Refresh * refresh = cello::refresh(ir_post_);
   cello::simulation()->refresh_set_name(ir_post_,name());
   refresh->add_field("density");
@@ -42,6 +59,10 @@ MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
   is_weight_child_ = cello::scalar_descr_long_long()->new_value(name() + ":weight_child",n);
   is_sync_index_   = cello::scalar_descr_sync()->new_value(name() + ":sync_index");
   is_sync_weight_  = cello::scalar_descr_sync()->new_value(name() + ":sync_weight");
+  is_cost_         = cello::scalar_descr_double()->new_value(name() + ":cost");
+  is_cost_child_   = cello::scalar_descr_double()->new_value(name() + ":cost_child",n);
+  is_cost_index_   = cello::scalar_descr_double()->new_value(name() + ":cost_index");
+  is_cost_count_   = cello::scalar_descr_double()->new_value(name() + ":cost_count");
 }
 
 //======================================================================
@@ -57,8 +78,12 @@ void MethodOrderHilbert::compute (Block * block) throw()
   *pindex_(block) = 0;
   *pcount_(block) = 0;
   *pweight_(block) = 1;
+  *pcost_(block) = block_cost_(block);
+  *pcost_index_(block) = 0.0;
+  *pcost_count_(block) = 0.0;
   for (int i=0; i<cello::num_children(); i++) {
     *pweight_child_(block,i) = 0;
+    *pcost_child_(block,i) = 0.0;
   }
   sync_index->reset();
   sync_weight->reset();
@@ -97,7 +122,7 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
   int weight = *pweight_(block);
   int ic3[3] = {0,0,0};
   if (self) {
-    recv_weight(block,ic3,0,true);
+    recv_weight(block,ic3,0,0.0,true);
   }
   const int level = block->level();
   if ((!self || block->is_leaf()) && level > min_level_)  {
@@ -105,8 +130,8 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     block->index().child(level,ic3,ic3+1,ic3+2,min_level_);
     TRACE_ORDER_BLOCK("send_weight",block);
     cello::block_array()[index_parent].p_method_order_hilbert_weight
-      (ic3,weight,block->index());
-    send_index(block, 0, 0, self);
+      (ic3,weight,cost_tree_(block),block->index());
+    send_index(block, 0, 0, 0.0, self);
   } else if (level == min_level_) {
 
     const int rank = cello::rank();
@@ -118,8 +143,9 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     *pindex_(block) = 0;
     *pcount_(block) = 0;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = 0.0;
 
-    send_index(block, 0, weight, self);
+    send_index(block, 0, weight, cost_tree_(block), self);
     if (!self) {
       CkCallback callback
         (CkIndex_Block::r_method_order_hilbert_complete (nullptr),
@@ -131,16 +157,17 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
 
 //----------------------------------------------------------------------
 
-void Block::p_method_order_hilbert_weight(int ic3[3], int weight, Index index_child)
+void Block::p_method_order_hilbert_weight
+(int ic3[3], int weight, double cost, Index index_child)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_weight(this, ic3,weight,false);
+    (this->method())->recv_weight(this, ic3,weight,cost,false);
 }
 
 //----------------------------------------------------------------------
 
 void MethodOrderHilbert::recv_weight
-(Block * block, int ic3[3], int weight, bool self)
+(Block * block, int ic3[3], int weight, double cost, bool self)
 {
   TRACE_ORDER_BLOCK("recv_weight",block);
   // Update children weight if needed
@@ -148,6 +175,7 @@ void MethodOrderHilbert::recv_weight
     *pweight_(block) += weight;
     int i = ic3[0] + 2*(ic3[1]+2*ic3[2]);
     *pweight_child_(block,i) = weight;
+    *pcost_child_(block,i) = cost;
   }
   if ((!block->is_leaf()) && psync_weight_(block)->next()) {
     // Forward weight to parent when computed
@@ -158,11 +186,13 @@ void MethodOrderHilbert::recv_weight
 }
 
 void MethodOrderHilbert::send_index
-(Block * block, int index_parent, int count, bool self)
+(Block * block, int index_parent, int count, double cost_count, bool self)
 {
   *pcount_(block) = count;
+  *pcost_count_(block) = cost_count;
   if (!block->is_leaf()) {
     int index = *pindex_(block) + 1;
+    double cost_index = *pcost_index_(block) + *pcost_(block);
 
     int children[cello::num_children()];
     hilbert_children(block, children);
@@ -173,21 +203,26 @@ void MethodOrderHilbert::send_index
       ic3[1] = (children[i] >> 1) & 1;
       ic3[2] = (children[i] >> 2) & 1;
       Index index_child = block->index().index_child(ic3,min_level_);
-      cello::block_array()[index_child].p_method_order_hilbert_index(index,count);
+      cello::block_array()[index_child].p_method_order_hilbert_index
+        (index,count,cost_index,cost_count);
 
       index += *pweight_child_(block, children[i]);
+      cost_index += *pcost_child_(block, children[i]);
     }
   }
 }
 
-void Block::p_method_order_hilbert_index(int index, int count)
+void Block::p_method_order_hilbert_index
+(int index, int count, double cost_index, double cost_count)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_index(this, index, count, false);
+    (this->method())->recv_index(this, index, count,
+                                 cost_index, cost_count, false);
 }
 
 void MethodOrderHilbert::recv_index
-(Block * block, int index, int count, bool self)
+(Block * block, int index, int count,
+ double cost_index, double cost_count, bool self)
 {
   {
     char buffer[80];
@@ -203,6 +238,8 @@ void MethodOrderHilbert::recv_index
     *pindex_(block) = index;
     *pcount_(block) = count;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = cost_index;
+    *pcost_count_(block) = cost_count;
   }
   if (psync_index_(block)->next()) {
     {
@@ -210,7 +247,7 @@ void MethodOrderHilbert::recv_index
       sprintf (buffer,"complete %d %d\n",index,count);
       TRACE_ORDER_BLOCK(buffer,block);
     } 
-    send_index(block,index, count, false);
+    send_index(block,index, count, cost_count, false);
     CkCallback callback (CkIndex_Block::r_method_order_hilbert_complete(nullptr),
                        block->proxy_array());
     block->contribute (callback);
@@ -292,6 +329,83 @@ long long * MethodOrderHilbert::pweight_child_(Block * block, int i)
 
 //----------------------------------------------------------------------
 
+double * MethodOrderHilbert::pcost_(Block * block)
+{
+  Scalar<double> scalar = block->data()->scalar_double();
+  return scalar.value(is_cost_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_child_(Block * block, int i)
+{
+  Scalar<double> scalar = block->data()->scalar_double();
+  return scalar.value(is_cost_child_)+i;
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_index_(Block * block)
+{
+  Scalar<double> scalar = block->data()->scalar_double();
+  return scalar.value(is_cost_index_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_count_(Block * block)
+{
+  Scalar<double> scalar = block->data()->scalar_double();
+  return scalar.value(is_cost_count_);
+}
+
+//----------------------------------------------------------------------
+
+double MethodOrderHilbert::cost_tree_(Block * block)
+{
+  double cost = *pcost_(block);
+  for (int i=0; i<cello::num_children(); i++) {
+    cost += *pcost_child_(block,i);
+  }
+  return cost;
+}
+
+//----------------------------------------------------------------------
+
+double MethodOrderHilbert::block_cost_(Block * block)
+{
+  if (cost_type_ == "particles") {
+
+    // include the Block itself so that Blocks without particles
+    // still have non-zero cost
+    return 1.0 + block->data()->particle().num_particles();
+
+  } else if (cost_type_ == "time") {
+
+    // wall time spent computing since the last ordering
+    const double time = block->compute_time();
+    block->reset_compute_time();
+    return time;
+
+  } else if (cost_type_ == "value") {
+
+    // user expression evaluated at the Block center
+    if (! block->is_leaf()) return 0.0;
+    double xm,ym,zm,xp,yp,zp;
+    block->lower(&xm,&ym,&zm);
+    block->upper(&xp,&yp,&zp);
+    return std::max(0.0,cost_value_->evaluate
+                    (block->time(),0.5*(xm+xp),0.5*(ym+yp),0.5*(zm+zp)));
+
+  } else {
+
+    return 1.0;
+
+  }
+}
+
+//----------------------------------------------------------------------
+
 Sync * MethodOrderHilbert::psync_weight_(Block * block)
 {
   Scalar<Sync> scalar(cello::scalar_descr_sync(),
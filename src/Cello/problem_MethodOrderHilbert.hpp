@@ -28,14 +28,19 @@ class MethodOrderHilbert : public Method {
 public: // interface
 
   /// Constructor
-  MethodOrderHilbert(int min_level) throw();
+  MethodOrderHilbert(ParameterGroup p, int min_level) throw();
+
+  /// Destructor
+  virtual ~MethodOrderHilbert() throw()
+  { delete cost_value_; }
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodOrderHilbert);
   
   /// Charm++ PUP::able migration constructor
   MethodOrderHilbert (CkMigrateMessage *m)
-    : Method (m)
+    : Method (m),
+      cost_value_(nullptr)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -50,14 +55,28 @@ public: // interface
     p | is_sync_index_;
     p | is_sync_weight_;
     p | min_level_;
+    p | is_cost_;
+    p | is_cost_child_;
+    p | is_cost_index_;
+    p | is_cost_count_;
+    p | cost_type_;
+    bool has_cost_value = (cost_value_ != nullptr);
+    p | has_cost_value;
+    if (has_cost_value) {
+      if (p.isUnpacking()) cost_value_ = new Value;
+      p | *cost_value_;
+    }
   }
 
   void compute_continue( Block * block);
   void compute_complete( Block * block);
   void send_weight(Block * block, int weight, bool self);
-  void recv_weight(Block * block, int ic3[3], int weight, bool self);
-  void send_index(Block * block, int index, int count, bool self);
-  void recv_index(Block * block, int index, int count, bool self);
+  void recv_weight(Block * block, int ic3[3], int weight, double cost,
+                   bool self);
+  void send_index(Block * block, int index, int count, double cost_count,
+                  bool self);
+  void recv_index(Block * block, int index, int count,
+                  double cost_index, double cost_count, bool self);
 
 public: // virtual methods
   
@@ -67,6 +86,21 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "order_hilbert"; }
 
+  /// Does not access fields
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Communicates between Blocks, so is applied to all Blocks when
+  /// subcycling
+  virtual bool is_subcycled () const throw()
+  { return false; }
+
 private: // methods
 
   /// Return the pointer to the Block's Hilbert ordering index 
@@ -84,6 +118,26 @@ private: // methods
   /// Return the pointer to the given Block's child weight
   long long * pweight_child_(Block * block, int index);
 
+  /// Return the pointer to the Block's own cost
+  double * pcost_(Block * block);
+
+  /// Return the pointer to the given Block's child cost (including
+  /// the child's descendents)
+  double * pcost_child_(Block * block, int index);
+
+  /// Return the pointer to the total cost of Blocks preceding this
+  /// Block in the ordering
+  double * pcost_index_(Block * block);
+
+  /// Return the pointer to the total cost of all Blocks
+  double * pcost_count_(Block * block);
+
+  /// Return the cost of the Block and its descendents
+  double cost_tree_(Block * block);
+
+  /// Evaluate the Block's own cost according to cost_type_
+  double block_cost_(Block * block);
+
   /// Return the pointer to the Block's Hilbert ordering index 
   Sync * psync_index_(Block * block);
 
@@ -136,6 +190,22 @@ private: // attributes
   /// Minimum refinement level for ordering; may be < 0
   int min_level_;
 
+  /// Block Scalar<double> own cost
+  int is_cost_;
+  /// Block Scalar<double> child cost (array of size cello::num_children())
+  int is_cost_child_;
+  /// Block Scalar<double> cost of preceding Blocks
+  int is_cost_index_;
+  /// Block Scalar<double> cost of all Blocks
+  int is_cost_count_;
+
+  /// Per-Block cost used for weighting the ordering: "block" (1 per
+  /// Block), "particles", "time", or "value"
+  std::string cost_type_;
+
+  /// Expression for the Block cost if cost_type_ is "value"
+  Value * cost_value_;
+
   /// Look up tables for encoding/decoding Hilbert indices
   static int HPM[12][8];
   static int HNM[12][8];
@@ -62,7 +62,15 @@ MethodOutput::MethodOutput(const Factory * factory, ParameterGroup p) noexcept
                  p.list_value_integer(0,"blocking",1),
                  p.list_value_integer(1,"blocking",1),
                  p.list_value_integer(2,"blocking",1))
-{ }
+{
+  compress_level_ = p.value_integer("compress_level",0);
+  shuffle_        = p.value_logical("shuffle",true);
+  chunk_size_     = p.value_integer("chunk_size",0);
+
+  ASSERT1("MethodOutput::MethodOutput",
+          "Method:output:compress_level %d must be between 0 and 9",
+          compress_level_, (0 <= compress_level_ && compress_level_ <= 9));
+}
 
 //----------------------------------------------------------------------
 
@@ -93,7 +101,10 @@ MethodOutput::MethodOutput
       is_count_(-1),
       is_block_list_(-1),
       factory_(factory),
-      all_blocks_(all_blocks)
+      all_blocks_(all_blocks),
+      compress_level_(0),
+      shuffle_(true),
+      chunk_size_(0)
 {
   if (field_list.size() > 0) {
     field_list_.resize(field_list.size());
@@ -196,6 +207,9 @@ void MethodOutput::pup (PUP::er &p)
   p | is_block_list_;
   p | factory_nonconst_;
   p | all_blocks_;
+  p | compress_level_;
+  p | shuffle_;
+  p | chunk_size_;
 }
 
 //----------------------------------------------------------------------
@@ -317,9 +331,7 @@ void MethodOutput::compute_continue(Block * block)
 
   } else {
     // Close file
-    FileHdf5 * file = msg_output->file();
-    file->file_close();
-    delete file;
+    file_close_(msg_output->file());
 
     // Close *.block_list file
     ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
@@ -418,9 +430,7 @@ void MethodOutput::write(Block * block, MsgOutput * msg_output_in )
   if (index_next == index_home) {
     // done
     // Close file
-    FileHdf5 * file = msg_output->file();
-    file->file_close();
-    delete file;
+    file_close_(msg_output->file());
     delete msg_output;
 
     // Close *.block_list file
@@ -490,6 +500,9 @@ FileHdf5 * MethodOutput::file_open_(Block * block, int a3[3])
 
   // Create File
   FileHdf5 * file = new FileHdf5 (path_name, file_name);
+  file->set_compress(compress_level_);
+  file->set_shuffle(shuffle_);
+  file->set_chunk_size(chunk_size_);
   file->file_create();
 
   // Change directory for file_list and block_list files
@@ -504,6 +517,21 @@ FileHdf5 * MethodOutput::file_open_(Block * block, int a3[3])
 
 //----------------------------------------------------------------------
 
+void MethodOutput::file_close_(FileHdf5 * file)
+{
+  file->file_close();
+
+  Performance * performance = cello::simulation()->performance();
+  performance->increment_counter
+    (perf_index_disk_bytes, file->bytes_written());
+  performance->increment_counter
+    (perf_index_disk_usec, (long long)(1e6*file->time_write()));
+
+  delete file;
+}
+
+//----------------------------------------------------------------------
+
 void MethodOutput::file_write_hierarchy_(FileHdf5 * file)
 {
   IoHierarchy io_hierarchy = (cello::hierarchy());
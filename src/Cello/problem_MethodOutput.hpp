@@ -81,6 +81,21 @@ public: // interface
   virtual std::string name () throw ()
   { return "output"; }
 
+  /// Fields are written at their own precision
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Communicates between Blocks, so is applied to all Blocks when
+  /// subcycling
+  virtual bool is_subcycled () const throw()
+  { return false; }
+
 protected: // functions
 
   void output_ (Block * block);
@@ -88,6 +103,7 @@ protected: // functions
   int is_writer_ (Index index);
 
   FileHdf5 * file_open_(Block * block, int a3[3]);
+  void file_close_(FileHdf5 * file);
   void file_write_hierarchy_(FileHdf5 * file);
   void file_write_block_(FileHdf5 * , Block * , MsgOutput *);
   int file_count_(Block * block);
@@ -140,5 +156,14 @@ protected: // attributes
 
   /// Whether to output all blocks or just leaf-blocks
   bool all_blocks_;
+
+  /// HDF5 deflate compression level, 0 for none
+  int compress_level_;
+
+  /// Whether to shuffle bytes before compressing
+  bool shuffle_;
+
+  /// Maximum HDF5 chunk extent along each axis, 0 for whole datasets
+  int chunk_size_;
 };
 #endif /* PROBLEM_METHOD_OUTPUT_HPP */
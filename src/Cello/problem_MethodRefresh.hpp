@@ -63,6 +63,21 @@ public: // virtual functions
   virtual std::string name () throw ()
   { return "refresh"; }
 
+  /// Ghost zones are refreshed at each field's own precision
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Only ghost zones are modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Communicates between Blocks, so is applied to all Blocks when
+  /// subcycling
+  virtual bool is_subcycled () const throw()
+  { return false; }
+
 protected: // functions
 
   void refresh_ (Block * block);
@@ -58,6 +58,16 @@ public: // virtual functions
   virtual std::string name () throw ()
   { return "trace"; }
 
+  /// Velocities are read as single or double precision
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return field_name.compare(0, 9, "velocity_") != 0; }
+
+  /// Only tracer particles are modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
 protected: // functions
 
 
@@ -477,6 +477,9 @@ void Problem::initialize_method
 
   Method::courant_global = config->method_courant_global;
 
+  // indices in method_list_ of methods requesting timestep candidates
+  std::vector<size_t> index_candidate;
+
   // in the future, it might be nice to refactor Problem::create_method_ so
   // that we can use it to construct this first MethodNull object. (But that
   // may be somewhat involved)
@@ -498,6 +501,13 @@ void Problem::initialize_method
 
       method_list_.push_back(method); 
 
+      method->set_index_timer
+        (cello::simulation()->performance()->new_timer("method_" + name));
+
+      if (config->method_timestep_candidate[index_method]) {
+        index_candidate.push_back(method_list_.size() - 1);
+      }
+
       int index_schedule = config->method_schedule_index[index_method];
 
       if (index_schedule != -1) {
@@ -515,6 +525,31 @@ void Problem::initialize_method
 	     "Unknown Method %s",name.c_str());
     }
   }
+
+  // Timestep candidates are computed at the end of the method's
+  // compute(), so they are only used if no later method modifies the
+  // fields they depend on
+
+  for (size_t index_method : index_candidate) {
+    Method * method = method_list_[index_method];
+    std::string modified = "";
+    for (const std::string & field_name : method->timestep_fields()) {
+      for (size_t index_later = index_method + 1;
+           index_later < method_list_.size(); index_later++) {
+        if (method_list_[index_later]->modifies_field(field_name)) {
+          modified = method_list_[index_later]->name() + " modifies "
+            + field_name;
+        }
+      }
+    }
+    if (modified == "") {
+      method->enable_timestep_candidate();
+    } else {
+      WARNING2("Problem::initialize_method",
+               "Ignoring Method:%s:timestep_candidate since Method %s",
+               method->name().c_str(), modified.c_str());
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -533,6 +568,10 @@ void Problem::initialize_solver( Config * config ) throw()
 
       solver_list_.push_back(solver); 
 
+      solver->set_index_timer
+        (cello::simulation()->performance()->new_timer
+         ("solver_" + config->solver_list[index_solver]));
+
     } else {
       ERROR1("Problem::initialize_solver",
 	     "Unknown Solver %s",type.c_str());
@@ -929,11 +968,11 @@ Method * Problem::create_method_
     // TODO: refactor to use a factory method/default constructor
     //   - can we look up mesh_min_level from an existing object? Like Adapt or
     //     Hierarchy?
-    method = new MethodOrderMorton(config->mesh_min_level);
+    method = new MethodOrderMorton(p_group,config->mesh_min_level);
 
   } else if (name == "order_hilbert") {
 
-    method = new MethodOrderHilbert(config->mesh_min_level);
+    method = new MethodOrderHilbert(p_group,config->mesh_min_level);
 
   } else if (name == "refresh") {
     method = new MethodRefresh(p_group);
@@ -1009,7 +1048,7 @@ Output * Problem::create_output_
       (image_min != std::numeric_limits<double>::max()) &&
       (image_max != -std::numeric_limits<double>::max());
     
-    output = new OutputImage (index,factory,
+    OutputImage * output_image = new OutputImage (index,factory,
 			      CkNumPes(),
 			      config->mesh_root_size,
 			      config->mesh_root_blocks,
@@ -1031,6 +1070,13 @@ Output * Problem::create_output_
                               use_min_max,
 			      image_min, image_max);
 
+    output_image->set_reduce_arity
+      (config->output_image_reduce_arity[index]);
+    output_image->set_reduce_float
+      (config->output_image_reduce_precision[index] == "single");
+
+    output = output_image;
+
   } else if (name == "data") {
 
     output = new OutputData (index,factory,config);
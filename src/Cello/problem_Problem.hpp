@@ -273,6 +273,11 @@ protected: // functions
    Config * config,
    const Factory * factory) throw ();
 
+  /// Send this process's output data (merged with that of its child
+  /// processes, if any) to its parent process, and proceed with next
+  /// output
+  void output_send_ (Simulation * simulation) throw();
+
   /// Create named output object
   virtual Output *   create_output_  
   (std::string type,
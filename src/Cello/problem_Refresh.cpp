@@ -150,6 +150,7 @@ int Refresh::data_size () const
   SIZE_SCALAR_TYPE(count,int,min_face_rank_);
   SIZE_SCALAR_TYPE(count,int,neighbor_type_);
   SIZE_SCALAR_TYPE(count,int,accumulate_);
+  SIZE_SCALAR_TYPE(count,int,aggregate_);
   SIZE_SCALAR_TYPE(count,int,sync_type_);
   SIZE_SCALAR_TYPE(count,int,sync_id_);
   SIZE_SCALAR_TYPE(count,int,active_);
@@ -183,6 +184,7 @@ char * Refresh::save_data (char * buffer) const
   SAVE_SCALAR_TYPE(p,int,min_face_rank_);
   SAVE_SCALAR_TYPE(p,int,neighbor_type_);
   SAVE_SCALAR_TYPE(p,int,accumulate_);
+  SAVE_SCALAR_TYPE(p,int,aggregate_);
   SAVE_SCALAR_TYPE(p,int,sync_type_);
   SAVE_SCALAR_TYPE(p,int,sync_id_);
   SAVE_SCALAR_TYPE(p,int,active_);
@@ -220,6 +222,7 @@ char * Refresh::load_data (char * buffer)
   LOAD_SCALAR_TYPE(p,int,min_face_rank_);
   LOAD_SCALAR_TYPE(p,int,neighbor_type_);
   LOAD_SCALAR_TYPE(p,int,accumulate_);
+  LOAD_SCALAR_TYPE(p,int,aggregate_);
   LOAD_SCALAR_TYPE(p,int,sync_type_);
   LOAD_SCALAR_TYPE(p,int,sync_id_);
   LOAD_SCALAR_TYPE(p,int,active_);
@@ -34,6 +34,7 @@ public: // interface
     min_face_rank_(0),
     neighbor_type_(neighbor_leaf),
     accumulate_(false),
+    aggregate_(false),
     sync_type_   (sync_unknown),
     sync_id_ (-1),
     active_(true),
@@ -64,6 +65,7 @@ public: // interface
       min_face_rank_(min_face_rank),
       neighbor_type_(neighbor_type),
       accumulate_(false),
+      aggregate_(false),
       sync_type_(sync_type),
       sync_id_(sync_id),
       active_(active),
@@ -92,6 +94,7 @@ public: // interface
     min_face_rank_(0),
     neighbor_type_(0),
     accumulate_(false),
+    aggregate_(false),
     sync_type_(0),
     sync_id_ (-1),
     active_(true),
@@ -120,6 +123,7 @@ public: // interface
     p | min_face_rank_;
     p | neighbor_type_;
     p | accumulate_;
+    p | aggregate_;
     p | sync_type_;
     p | sync_id_;
     p | active_;
@@ -326,6 +330,16 @@ public: // interface
     accumulate_ = accumulate;
   }
 
+  /// Return whether field faces sent to Blocks on other processes
+  /// are packed into a single message per destination process
+  bool aggregate() const
+  { return aggregate_; }
+
+  /// Set whether to aggregate field faces sent to Blocks on other
+  /// processes into one message per destination process
+  void set_aggregate(bool aggregate)
+  { aggregate_ = aggregate; }
+
   // Boxes
   void box_accumulate_adjust (Box * box, int if3[3], int g3[3]);
 
@@ -371,6 +385,7 @@ public: // interface
     fprintf (fp,"     min_face_rank: %d\n",min_face_rank_);
     fprintf (fp,"     neighbor_type: %d\n",neighbor_type_);
     fprintf (fp,"     accumulate: %d\n",accumulate_);
+    fprintf (fp,"     aggregate: %d\n",aggregate_);
     fprintf (fp,"     sync_type: %d\n",sync_type_);
     fprintf (fp,"     sync_id: %d\n",sync_id_);
     fprintf (fp,"     id_refresh: %d\n",id_refresh_);
@@ -500,6 +515,9 @@ private: // attributes
   /// Whether to copy or add values
   int accumulate_;
 
+  /// Whether to pack remote field faces into one message per process
+  int aggregate_;
+
   /// Synchronization type
   int sync_type_;
 
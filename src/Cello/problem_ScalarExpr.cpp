@@ -5,8 +5,6 @@
 /// @date     2014-03-31
 /// @brief    Implementation of the ScalarExpr class
 
-#include <cstring>
-
 #include "problem.hpp"
 
 //----------------------------------------------------------------------
@@ -53,81 +51,50 @@ void ScalarExpr::evaluate (T * value, double t,
 	  ndx,ndy,ndz,nx,ny,nz,
 	  (ndx >= nx) && (ndy >= ny) && (ndz >= nz));
 
-  if ((!param_) && (!mask)) {
-    // fast-path that avoid heap allocations - relevant for inflow conditions
-    for (int iz=0; iz<nz; iz++) {
-      for (int iy=0; iy<ny; iy++) {
-	for (int ix=0; ix<nx; ix++) {
-          value[ix + ndx*(iy + ndy*iz)] = (T)value_;
-        }
-      }
-    }
-    return;
-  }
-
   bool * mv = 0;
   if (mask) {
     mv = new bool [ nx*ny*nz ];
     mask->evaluate(mv, t, nx,nx,xv, ny,ny,yv, nz,nz,zv);
   }
 
-  double * value_temp = new double [nx*ny*nz];
-  double * x = new double [ nx*ny*nz ];
-  double * y = new double [ nx*ny*nz ];
-  double * z = new double [ nx*ny*nz ];
+  if (param_) {
 
-  for (int i=0; i<nx*ny*nz; i++) {
-    x[i] = y[i] = z[i] = 0.0;
-  }
-  
-  for (int iz=0; iz<nz; iz++) {
-    for (int iy=0; iy<ny; iy++) {
-      for (int ix=0; ix<nx; ix++) {
-	int i=ix + nx*(iy + ny*iz);
-	x[i] = xv[ix];
-	y[i] = yv[iy];
-	z[i] = zv[iz];
-	value_temp[i] = 0.0;
-      }
-    }
-  }
+    // compiled expression is evaluated directly into value, only
+    // where the mask is true
 
-  int n=nx*ny*nz;
+    param_->expr()->evaluate
+      (value,t,ndx,nx,xv,ndy,ny,yv,ndz,nz,zv,mv);
 
-  if (param_) {
-    param_->evaluate_float(n, value_temp, x,y,z,t);
   } else {
-    for (int i=0; i<n; i++) value_temp[i]=value_;
-  }
 
-  if (mask) {
     for (int iz=0; iz<nz; iz++) {
       for (int iy=0; iy<ny; iy++) {
 	for (int ix=0; ix<nx; ix++) {
 	  int i=ix + nx*(iy + ny*iz);
-	  int id=ix + ndx*(iy + ndy*iz);
-	  value[id] = mv[i] ? (T) value_temp[i] : deflt[id];
-	}
+	  if (!mv || mv[i]) {
+	    value[ix + ndx*(iy + ndy*iz)] = (T)value_;
+	  }
+        }
       }
     }
-  } else {
-    for (int iz=0; iz<nz; iz++) {
-      for (int iy=0; iy<ny; iy++) {
-        for (int ix=0; ix<nx; ix++) {
-	  int i=ix + nx*(iy + ny*iz);
-	  int id=ix + ndx*(iy + ndy*iz);
-	  value[id] = (T) (value_temp[i]);
+  }
+
+  // masked-out values are set to the default, which may alias value
+
+  if (mv) {
+    if (deflt != value) {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int i=ix + nx*(iy + ny*iz);
+	    int id=ix + ndx*(iy + ndy*iz);
+	    if (!mv[i]) value[id] = deflt[id];
+	  }
 	}
       }
     }
+    delete [] mv;
   }
-
-  if (mv) { delete [] mv; }
-  delete [] value_temp;
-  delete [] z;
-  delete [] y;
-  delete [] x;
-
 }
 
 
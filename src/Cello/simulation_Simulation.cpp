@@ -38,6 +38,10 @@ Simulation::Simulation
   time_(0.0),
   dt_(0),
   stop_(false),
+  subcycle_cycle_(0),
+  subcycle_time_(0.0),
+  subcycle_dt_(0.0),
+  subcycle_max_level_(0),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
@@ -110,6 +114,10 @@ Simulation::Simulation()
   time_(0.0),
   dt_(0),
   stop_(false),
+  subcycle_cycle_(0),
+  subcycle_time_(0.0),
+  subcycle_dt_(0.0),
+  subcycle_max_level_(0),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
@@ -251,6 +259,10 @@ void Simulation::pup (PUP::er &p)
   p | time_;
   p | dt_;
   p | stop_;
+  p | subcycle_cycle_;
+  p | subcycle_time_;
+  p | subcycle_dt_;
+  p | subcycle_max_level_;
   p | phase_;
 
   p | problem_; // PUPable
@@ -395,6 +407,8 @@ void Simulation::initialize_memory_() throw()
     memory->set_active(config_->memory_active);
     memory->set_warning_mb (config_->memory_warning_mb);
     memory->set_limit_gb (config_->memory_limit_gb);
+    memory->set_sampling (config_->memory_sample_interval,
+                           config_->memory_sample_bytes);
   }
 }
 //----------------------------------------------------------------------
@@ -424,6 +438,8 @@ void Simulation::initialize_performance_() throw()
   p->new_region(perf_refresh_store_sync, "refresh_store_sync",in_charm);
   p->new_region(perf_refresh_child_sync, "refresh_child_sync",in_charm);
   p->new_region(perf_refresh_exit_sync,  "refresh_exit_sync",in_charm);
+  p->new_region(perf_refresh_setup,      "refresh_setup");
+  p->new_region(perf_refresh_load,       "refresh_load");
   p->new_region(perf_compute,            "compute");
   p->new_region(perf_control,            "control");
   p->new_region(perf_output,             "output");
@@ -546,6 +562,7 @@ void Simulation::initialize_data_descr_() throw()
   
   field_descr_->set_padding (config_->field_padding);
 
+  field_descr_->set_history_fields (config_->field_history_fields);
   field_descr_->set_history (config_->field_history);
 
   for (int i=0; i<field_descr_->field_count(); i++) {
@@ -952,10 +969,17 @@ void Simulation::monitor_performance()
   // 13+ max_node_blocks
   // 14+ max_node_particles
   // 15+ max_solver_iters
-  
+  // NT  timer sum and count
+  // NG  sampled allocation calls and bytes per Memory group
+  // NT  timer max and -min
+
   const int num_solver = problem()->num_solvers();
+  const int nt = performance_->num_timers();
+
+  Memory * memory = Memory::instance();
+  const int ng = (memory && memory->is_sampling()) ? memory->num_groups() : 0;
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc + 4*nt + 2*ng;
 
   
   long long * counters_region = new long long [nc];
@@ -964,7 +988,7 @@ void Simulation::monitor_performance()
   const int in = cello::index_static();
   
   int m=0;
-  const int num_max = 4 + num_solver;
+  const int num_max = 4 + num_solver + 2*nt;
   counters_reduce[m++] = n - num_max - 2;
   counters_reduce[m++] = num_max;
   
@@ -998,6 +1022,24 @@ void Simulation::monitor_performance()
     }
   }
 
+  // Method and Solver timers: per-Block times are summed, and the
+  // minimum is reduced as the maximum of its negative
+
+  std::vector<long long> timer_min(nt), timer_max(nt);
+  for (int it = 0; it < nt; it++) {
+    long long sum, count;
+    performance_->timer_values(it,&sum,&count,&timer_min[it],&timer_max[it]);
+    counters_reduce[m++] = sum;
+    counters_reduce[m++] = count;
+    if (count == 0) timer_min[it] = std::numeric_limits<long long>::max();
+  }
+
+  // sampled allocations since the last performance output
+  for (int ig = 0; ig < ng; ig++) {
+    counters_reduce[m++] = memory->sample_new_calls(ig);
+    counters_reduce[m++] = memory->sample_new_bytes(ig);
+  }
+
   // maximum metrics
   
   counters_reduce[m++] = num_blocks_total;            // 11  max_proc_blocks
@@ -1007,6 +1049,10 @@ void Simulation::monitor_performance()
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
   }
+  for (int it = 0; it < nt; it++) {
+    counters_reduce[m++] =   timer_max[it];
+    counters_reduce[m++] = - timer_min[it];
+  }
 
   ASSERT2("Simulation::monitor_performance()",
 	  "Actual array length %d != expected array length %d", m,n,
@@ -1028,6 +1074,9 @@ void Simulation::monitor_performance()
   delete [] counters_reduce;
   delete [] counters_region;
 
+  // Method and Solver timers are reported per performance output
+  performance_->clear_timers();
+  if (ng > 0) memory->reset_sample();
 }
 
 //----------------------------------------------------------------------
@@ -1092,6 +1141,17 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     monitor()->print
       ("Performance","simulation num-total-blocks %lld", num_total_blocks);
 
+    // all Blocks have the same size, so leaf cells are the cells
+    // updated each cycle
+    long long num_block_cells = 1;
+    for (int axis=0; axis<cello::rank(); axis++) {
+      num_block_cells *=
+        config_->mesh_root_size[axis] / config_->mesh_root_blocks[axis];
+    }
+    monitor()->print
+      ("Performance","simulation num-leaf-cells %lld",
+       num_leaf_blocks*num_block_cells);
+
     const long long num_blocks_total   = counters_reduce[m++]; // 10
 
     if (num_total_blocks != num_blocks_total) {
@@ -1118,6 +1178,29 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
       }
     }
 
+    const int num_timers = performance_->num_timers();
+    std::vector<long long> timer_sum(num_timers), timer_count(num_timers);
+    for (int it = 0; it < num_timers; it++) {
+      timer_sum[it]   = counters_reduce[m++];
+      timer_count[it] = counters_reduce[m++];
+    }
+
+    // estimated allocations per Memory group from sampling
+    Memory * memory = Memory::instance();
+    const int num_groups =
+      (memory && memory->is_sampling()) ? memory->num_groups() : 0;
+    for (int ig = 0; ig < num_groups; ig++) {
+      const long long sample_calls = counters_reduce[m++];
+      const long long sample_bytes = counters_reduce[m++];
+      if (sample_calls > 0) {
+        const std::string group = ig ? memory->group_name(ig) : "total";
+        monitor()->print("Performance","sample %s new-calls %lld",
+                         group.c_str(), sample_calls);
+        monitor()->print("Performance","sample %s new-bytes %lld",
+                         group.c_str(), sample_bytes);
+      }
+    }
+
     const long long max_proc_blocks    = counters_reduce[m++]; // 11
     const long long max_proc_particles = counters_reduce[m++]; // 12
     const long long max_node_blocks    = counters_reduce[m++]; // 13
@@ -1131,6 +1214,19 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     }
     cello::simulation()->clear_solver_iter(); // clear it for the next solve
 
+    for (int it = 0; it < num_timers; it++) {
+      const long long timer_max =   counters_reduce[m++];
+      const long long timer_min = - counters_reduce[m++];
+      if (timer_count[it] > 0) {
+        const std::string timer_name = performance_->timer_name(it);
+        monitor()->print("Performance","%s time-usec %lld",
+                         timer_name.c_str(), timer_sum[it]);
+        monitor()->print("Performance","%s block-time-usec min %lld avg %lld max %lld",
+                         timer_name.c_str(), timer_min,
+                         timer_sum[it]/timer_count[it], timer_max);
+      }
+    }
+
     monitor()->print
       ("Performance","simulation max-proc-blocks %lld",  max_proc_blocks);
     monitor()->print
@@ -137,6 +137,17 @@ public: // interface
   void set_stop(bool stop) throw()
   { stop_ = stop; }
 
+  /// Start a new subcycled step of the coarsest level, beginning at
+  /// the given cycle and time with level-0 timestep dt over levels
+  /// 0 to max_level (see "Stopping:subcycle")
+  void set_subcycle(int cycle, double time, double dt, int max_level) throw()
+  {
+    subcycle_cycle_     = cycle;
+    subcycle_time_      = time;
+    subcycle_dt_        = dt;
+    subcycle_max_level_ = std::max(0,max_level);
+  }
+
   /// Return true iff cycle_ changes
   bool cycle_changed() {
     bool value = false;
@@ -163,6 +174,35 @@ public: // interface
   double dt() const throw() 
   { return dt_; };
 
+  /// Return the number of cycles per step of the given level when
+  /// subcycling: levels at or below 0 take one step per level-0 step
+  int subcycle_period(int level) const throw()
+  { return 1 << std::max(0, subcycle_max_level_ - std::max(0,level)); }
+
+  /// Return the subcycled timestep of the given level
+  double subcycle_dt(int level) const throw()
+  { return subcycle_dt_ / (1 << std::max(0,level)); }
+
+  /// Return whether a step of the given level begins at cycle
+  bool subcycle_begin(int level, int cycle) const throw()
+  { return ((cycle - subcycle_cycle_) % subcycle_period(level)) == 0; }
+
+  /// Return whether a step of the given level ends at cycle
+  bool subcycle_end(int level, int cycle) const throw()
+  { return ((cycle - subcycle_cycle_ + 1) % subcycle_period(level)) == 0; }
+
+  /// Return whether all levels are synchronized at the start of cycle
+  bool subcycle_sync(int cycle) const throw()
+  { return subcycle_begin(0,cycle); }
+
+  /// Return the time at the start of the given cycle, the time of
+  /// the finest level
+  double subcycle_time(int cycle) const throw()
+  {
+    return subcycle_time_ +
+      (cycle - subcycle_cycle_) * subcycle_dt(subcycle_max_level_);
+  }
+
   /// Return the current stopping criteria (stored from main reduction)
   bool stop() const throw() 
   { return stop_; };
@@ -284,6 +324,10 @@ public: // virtual functions
   /// proceed with next output
   void p_output_write (int n, char * buffer);
 
+  /// Receive field faces packed by a Block on another process for
+  /// Blocks on this process, and deliver each to its destination
+  void p_refresh_recv_aggregate (int n, char * buffer);
+
   //--------------------------------------------------
   // Compute
   //--------------------------------------------------
@@ -383,6 +427,9 @@ public: // virtual functions
 	   (id_refresh >= 0));
     refresh_list_.push_back(refresh);
     refresh_list_[id_refresh].set_id(id_refresh);
+    if (config_ && config_->mesh_refresh_aggregate) {
+      refresh_list_[id_refresh].set_aggregate(true);
+    }
     return id_refresh;
   }
   void refresh_set_name (int id, std::string name)
@@ -516,6 +563,18 @@ protected: // attributes
   /// Current stopping criteria
   bool stop_;
 
+  /// Cycle at the start of the current level-0 step when subcycling
+  int subcycle_cycle_;
+
+  /// Time at the start of the current level-0 step when subcycling
+  double subcycle_time_;
+
+  /// Level-0 timestep when subcycling
+  double subcycle_dt_;
+
+  /// Finest level of the current level-0 step when subcycling
+  int subcycle_max_level_;
+
   /// Current phase of the cycle
   mutable int phase_;
 
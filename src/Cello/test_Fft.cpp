@@ -0,0 +1,137 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Fft.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program for the Fft class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "compute.hpp"
+
+typedef std::complex<double> complex_type;
+
+//----------------------------------------------------------------------
+
+/// Direct O(n^2) DFT for reference
+std::vector<complex_type> dft (const std::vector<complex_type> & a, int sign)
+{
+  const int n = a.size();
+  std::vector<complex_type> b(n,complex_type(0.0,0.0));
+  for (int k=0; k<n; k++) {
+    for (int j=0; j<n; j++) {
+      const long long jk = ((long long)(j)*k) % n;
+      b[k] += a[j] * std::polar(1.0, sign*2.0*cello::pi*jk/n);
+    }
+  }
+  return b;
+}
+
+/// Maximum relative difference between two sequences
+double difference (const std::vector<complex_type> & a,
+                   const std::vector<complex_type> & b)
+{
+  double d = 0.0, s = 0.0;
+  for (size_t i=0; i<a.size(); i++) {
+    d = std::max(d, std::abs(a[i]-b[i]));
+    s = std::max(s, std::abs(b[i]));
+  }
+  return (s > 0.0) ? d/s : d;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Fft");
+
+  // power-of-two and Bluestein lengths
+  const int sizes[] = {1, 2, 3, 8, 12, 17, 64, 100};
+
+  for (int n : sizes) {
+
+    Fft fft(n);
+
+    std::vector<complex_type> a(n);
+    for (int j=0; j<n; j++) {
+      a[j] = complex_type(sin(1.3*j + 0.2), cos(0.7*j*j));
+    }
+
+    //--------------------------------------------------
+    unit_func("forward");
+    //--------------------------------------------------
+
+    unit_assert (fft.size() == n);
+
+    std::vector<complex_type> b = a;
+    fft.forward(b.data());
+    unit_assert (difference(b,dft(a,-1)) < 1e-12);
+
+    //--------------------------------------------------
+    unit_func("backward");
+    //--------------------------------------------------
+
+    std::vector<complex_type> c = a;
+    fft.backward(c.data());
+    unit_assert (difference(c,dft(a,+1)) < 1e-12);
+
+    fft.backward(b.data());
+    for (int j=0; j<n; j++) b[j] /= n;
+    unit_assert (difference(b,a) < 1e-12);
+
+    //--------------------------------------------------
+    unit_func("forward_real");
+    //--------------------------------------------------
+
+    std::vector<double> x0(n), x1(n);
+    std::vector<complex_type> z0(n), z1(n);
+    for (int j=0; j<n; j++) {
+      z0[j] = x0[j] = 0.3*j - 1.0;
+      z1[j] = x1[j] = sin(1.0*j);
+    }
+
+    std::vector<complex_type> y0(n/2+1), y1(n/2+1);
+    fft.forward_real(x0.data(),x1.data(),y0.data(),y1.data());
+
+    std::vector<complex_type> d0 = dft(z0,-1);
+    std::vector<complex_type> d1 = dft(z1,-1);
+    d0.resize(n/2+1);
+    d1.resize(n/2+1);
+    unit_assert (difference(y0,d0) < 1e-12);
+    unit_assert (difference(y1,d1) < 1e-12);
+
+    //--------------------------------------------------
+    unit_func("backward_real");
+    //--------------------------------------------------
+
+    std::vector<double> r0(n), r1(n);
+    fft.backward_real(y0.data(),y1.data(),r0.data(),r1.data());
+    double err = 0.0;
+    for (int j=0; j<n; j++) {
+      err = std::max(err, std::abs(r0[j]/n - x0[j]));
+      err = std::max(err, std::abs(r1[j]/n - x1[j]));
+    }
+    unit_assert (err < 1e-12);
+
+    // a single real sequence
+
+    fft.forward_real(x1.data(),nullptr,y0.data(),nullptr);
+    unit_assert (difference(y0,d1) < 1e-12);
+    fft.backward_real(y0.data(),nullptr,r1.data(),nullptr);
+    err = 0.0;
+    for (int j=0; j<n; j++) err = std::max(err, std::abs(r1[j]/n - x1[j]));
+    unit_assert (err < 1e-12);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -649,6 +649,24 @@ PARALLEL_MAIN_BEGIN
     unit_assert(4.0 == v4[M4-1]);
     unit_assert(2.0 == v5[0] );
 
+    //----------------------------------------------------------------------
+    unit_func("values_to");
+
+    {
+      std::vector<double> array (M1, 0.0);
+      field.values_to (i1, array.data());
+      unit_assert(2.0 == array[0]);
+      unit_assert(2.0 == array[M1-1]);
+
+      unit_func("values_from");
+
+      std::fill (array.begin(),array.end(), 0.5);
+      field.values_from (i1, array.data());
+      unit_assert(0.5f == v1[0]);
+      unit_assert(0.5f == v1[M1-1]);
+      field.clear(2.0, 0, 0);
+    }
+
     //----------------------------------------------------------------------
     unit_func("reallocate_ghosts");
 
@@ -1287,6 +1305,70 @@ PARALLEL_MAIN_BEGIN
     unit_assert(info.gx==0 && info.gy==0 && info.gz==1);
 
   }
+
+  //----------------------------------------------------------------------
+  // Selective history
+  //----------------------------------------------------------------------
+
+  {
+    unit_class("FieldData");
+
+    int nx,ny,nz;
+    nx=4; ny=4; nz=4;
+    FieldDescr * field_descr = new FieldDescr;
+    FieldData * field_data = new FieldData(field_descr, nx,ny,nz);
+
+    Field field(field_descr,field_data);
+
+    int i1 = field.insert_permanent("h1");
+    int i2 = field.insert_permanent("h2");
+    int i3 = field.insert_permanent("h3");
+    for (int i : {i1,i2,i3}) field.set_precision(i,precision_double);
+
+    // save history of h1 by name and of h3 by group
+
+    field_descr->groups()->add("h3","hist");
+    field_descr->set_history_fields({"h1","hist"});
+    field.set_history(2);
+    field.allocate_permanent(true);
+
+    unit_func("has_history");
+    unit_assert(field.has_history(i1));
+    unit_assert(! field.has_history(i2));
+    unit_assert(field.has_history("h3"));
+
+    unit_func("values");
+    unit_assert(field.values(i1,1) != nullptr);
+    unit_assert(field.values(i2,1) == nullptr);
+    unit_assert(field.values(i2,2) == nullptr);
+    unit_assert(field.values(i3,2) != nullptr);
+
+    unit_func("save_history");
+
+    const int m = nx*ny*nz;
+    double * h1 = (double *) field.values(i1);
+    double * h2 = (double *) field.values(i2);
+    double * h3 = (double *) field.values(i3);
+    for (int i=0; i<m; i++) { h1[i] = 1.0; h2[i] = 2.0; h3[i] = 3.0; }
+    field.save_history(1.0);
+    for (int i=0; i<m; i++) { h1[i] = 10.0; h2[i] = 20.0; h3[i] = 30.0; }
+    field.save_history(2.0);
+
+    const double * h1_1 = (const double *) field.values(i1,1);
+    const double * h1_2 = (const double *) field.values(i1,2);
+    const double * h3_1 = (const double *) field.values(i3,1);
+    bool passed = true;
+    for (int i=0; i<m; i++) {
+      passed = passed && (h1_1[i] == 10.0) && (h1_2[i] == 1.0);
+      passed = passed && (h3_1[i] == 30.0);
+    }
+    unit_assert(passed);
+    unit_assert(field.history_time(1) == 2.0);
+    unit_assert(field.history_time(2) == 1.0);
+
+    delete field.field_descr();
+    delete field.field_data();
+  }
   //----------------------------------------------------------------------
   unit_finalize();
   //----------------------------------------------------------------------
@@ -355,6 +355,37 @@ PARALLEL_MAIN_BEGIN
 	  char * array;
 
 	  face_lower.face_to_array (field_lower, &n, &array);
+
+	  // reusing the FieldFace with its cached send regions must
+	  // give the same array
+
+	  unit_func("face_to_array (reused)");
+	  int n_reuse;
+	  char * array_reuse;
+	  face_lower.face_to_array (field_lower, &n_reuse, &array_reuse);
+	  unit_assert (n_reuse == n);
+	  unit_assert (memcmp(array,array_reuse,n) == 0);
+	  delete [] array_reuse;
+
+	  // changing the Refresh field list without changing its size
+	  // must not reuse send regions computed for other fields
+
+	  unit_func("face_to_array (field list changed)");
+	  std::vector<int> field_list_reversed (field_list.rbegin(),
+						field_list.rend());
+	  refresh.set_field_list(field_list_reversed);
+	  FieldFace face_fresh (face_lower);
+	  face_fresh.set_refresh(&refresh,false);
+	  int n_fresh;
+	  char * array_fresh;
+	  face_fresh.face_to_array (field_lower, &n_fresh, &array_fresh);
+	  face_lower.face_to_array (field_lower, &n_reuse, &array_reuse);
+	  unit_assert (n_reuse == n_fresh);
+	  unit_assert (memcmp(array_fresh,array_reuse,n_fresh) == 0);
+	  delete [] array_fresh;
+	  delete [] array_reuse;
+	  refresh.set_field_list(field_list);
+
 	  face_upper.array_to_face (array,field_upper);
 
 	  delete [] array;
@@ -387,6 +418,76 @@ PARALLEL_MAIN_BEGIN
   unit_func("face_to_array / array_to_face");
   unit_assert(test_fields(field_descr,field_data.data(),nbx,nby,nbz,mx,my,mz));
 
+  //----------------------------------------------------------------------
+  // Interpolate in time using the field history
+  //----------------------------------------------------------------------
+
+  {
+    FieldDescr * history_descr = new FieldDescr;
+    FieldData * history_data = new FieldData(history_descr, 4,4,4);
+    Field field (history_descr,history_data);
+
+    const int ih = field.insert_permanent("history");
+    const int in = field.insert_permanent("no_history");
+    for (int id : {ih,in}) {
+      field.set_precision(id,precision_double);
+      field.set_ghost_depth(id,1,1,1);
+    }
+
+    // only "history" has old values saved
+
+    history_descr->set_history_fields({"history"});
+    field.set_history(1);
+    field.allocate_permanent(true);
+
+    int mh3[3];
+    field.dimensions(ih,mh3,mh3+1,mh3+2);
+    const int mh = mh3[0]*mh3[1]*mh3[2];
+    double * vh = (double *) field.values(ih);
+    double * vn = (double *) field.values(in);
+    for (int i=0; i<mh; i++) { vh[i] = 0.0; }
+    field.save_history(0.0);
+    for (int i=0; i<mh; i++) { vh[i] = 2.0; vn[i] = 3.0; }
+
+    FieldFace face (3);
+    face.set_refresh_type(refresh_same);
+    face.set_ghost(1,1,1);
+    face.set_face(1,0,0);
+    face.set_history_weight(0.5);
+
+    Refresh refresh;
+    refresh.set_field_list({ih,in});
+    face.set_refresh(&refresh,false);
+
+    int n;
+    char * array;
+    face.face_to_array (field,&n,&array);
+
+    // the field with history is sent halfway between its history and
+    // current values, and the field without history is sent unchanged
+
+    unit_func("face_to_array (history)");
+    const int na = n / sizeof(double);
+    const double * a = (const double *) array;
+    bool passed = (na % 2 == 0) && (na > 0);
+    for (int i=0; i<na; i++) {
+      passed = passed && (a[i] == ((i < na/2) ? 1.0 : 3.0));
+    }
+    unit_assert(passed);
+    delete [] array;
+
+    // the Block's own values are restored after packing
+
+    passed = true;
+    for (int i=0; i<mh; i++) {
+      passed = passed && (vh[i] == 2.0) && (vn[i] == 3.0);
+    }
+    unit_assert(passed);
+
+    delete history_data;
+    delete history_descr;
+  }
+
   //----------------------------------------------------------------------	
   // clean up
   //----------------------------------------------------------------------	
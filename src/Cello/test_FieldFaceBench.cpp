@@ -0,0 +1,185 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldFaceBench.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Micro-benchmark for FieldFace ghost zone pack / unpack
+///
+/// Reports pack (face_to_array()) and unpack (array_to_face())
+/// bandwidth in GB/s for each face, edge, and corner of a block, for
+/// single and double precision fields, so that performance regressions
+/// in the FieldFace kernels are visible.
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+/// Block size and ghost depth used for the benchmark
+#define BENCH_BLOCK_SIZE  32
+#define BENCH_GHOST_DEPTH  4
+
+/// Minimum number of bytes to copy per face for stable timings
+#define BENCH_BYTES (64*1024*1024)
+
+//----------------------------------------------------------------------
+
+const char * face_shape (int fx, int fy, int fz)
+{
+  const int rank = (fx==0) + (fy==0) + (fz==0);
+  return (rank == 2) ? "face" : (rank == 1) ? "edge" : "corner";
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("FieldFace");
+
+  FieldDescr * field_descr = new FieldDescr;
+
+  const char * precision_name[2] = { "single", "double" };
+
+  field_descr->insert_permanent("field_single");
+  field_descr->insert_permanent("field_double");
+  field_descr->set_precision(0, precision_single);
+  field_descr->set_precision(1, precision_double);
+
+  const int g = BENCH_GHOST_DEPTH;
+  for (int i_f=0; i_f<2; i_f++) {
+    field_descr->set_ghost_depth(i_f,g,g,g);
+  }
+
+  const int n = BENCH_BLOCK_SIZE;
+  FieldData * field_data = new FieldData (field_descr,n,n,n);
+  field_data->allocate_permanent(field_descr,true);
+
+  Field field (field_descr,field_data);
+
+  // initialize field values including ghost zones
+
+  for (int i_f=0; i_f<2; i_f++) {
+    int mx,my,mz;
+    field.dimensions(i_f,&mx,&my,&mz);
+    const int m = mx*my*mz;
+    if (i_f == 0) {
+      float * values = (float *) field.values(i_f);
+      for (int i=0; i<m; i++) values[i] = i;
+    } else {
+      double * values = (double *) field.values(i_f);
+      for (int i=0; i<m; i++) values[i] = i;
+    }
+  }
+
+  bool bytes_match = true;
+  bool values_match = true;
+
+  for (int i_f=0; i_f<2; i_f++) {
+
+    std::vector<int> field_list;
+    field_list.push_back(i_f);
+    Refresh refresh;
+    refresh.set_field_list(field_list);
+
+    for (int fz=-1; fz<=1; fz++) {
+      for (int fy=-1; fy<=1; fy++) {
+	for (int fx=-1; fx<=1; fx++) {
+
+	  if (fx==0 && fy==0 && fz==0) continue;
+
+	  FieldFace field_face (3);
+	  field_face.set_refresh_type(refresh_same);
+	  field_face.set_ghost(0,0,0);
+	  field_face.set_face(fx,fy,fz);
+	  field_face.set_refresh(&refresh,false);
+
+	  const int num_bytes = field_face.num_bytes_array(field);
+	  std::vector<char> array(num_bytes);
+
+	  const int num_reps = std::max(1,BENCH_BYTES / num_bytes);
+
+	  // pack
+
+	  Timer timer_pack;
+	  timer_pack.start();
+	  for (int i=0; i<num_reps; i++) {
+	    field_face.face_to_array(field,array.data());
+	  }
+	  const double time_pack = timer_pack.stop();
+
+	  // unpack
+
+	  Timer timer_unpack;
+	  timer_unpack.start();
+	  for (int i=0; i<num_reps; i++) {
+	    field_face.array_to_face(array.data(),field);
+	  }
+	  const double time_unpack = timer_unpack.stop();
+
+	  const double gbytes = 1e-9*num_bytes*num_reps;
+
+	  CkPrintf ("FieldFace bench %-6s %-6s %2d %2d %2d  "
+		    "%8d bytes  pack %8.3f GB/s  unpack %8.3f GB/s\n",
+		    precision_name[i_f],face_shape(fx,fy,fz),fx,fy,fz,
+		    num_bytes,
+		    (time_pack   > 0.0) ? gbytes/time_pack   : 0.0,
+		    (time_unpack > 0.0) ? gbytes/time_unpack : 0.0);
+
+	  const int bytes_per_value = (i_f == 0) ? sizeof(float) : sizeof(double);
+	  const int num_values =
+	    (fx ? g : n) * (fy ? g : n) * (fz ? g : n);
+	  bytes_match = bytes_match &&
+	    (num_bytes == num_values*bytes_per_value);
+
+	  // array_to_face() stores the array into the ghost zones
+	  // opposite the packed face, as for a periodic neighbor, so
+	  // each of those ghost values must now equal the field value
+	  // one block width away
+
+	  int mx,my,mz;
+	  field.dimensions(i_f,&mx,&my,&mz);
+	  const int ix0 = (fx==1) ? 0 : ((fx==-1) ? n+g : g);
+	  const int iy0 = (fy==1) ? 0 : ((fy==-1) ? n+g : g);
+	  const int iz0 = (fz==1) ? 0 : ((fz==-1) ? n+g : g);
+	  const int d = fx*n + mx*(fy*n + my*fz*n);
+	  for (int iz=iz0; iz<iz0+(fz ? g : n); iz++) {
+	    for (int iy=iy0; iy<iy0+(fy ? g : n); iy++) {
+	      for (int ix=ix0; ix<ix0+(fx ? g : n); ix++) {
+		const int i = ix + mx*(iy + my*iz);
+		if (i_f == 0) {
+		  const float * values = (const float *) field.values(i_f);
+		  values_match = values_match && (values[i] == values[i+d]);
+		} else {
+		  const double * values = (const double *) field.values(i_f);
+		  values_match = values_match && (values[i] == values[i+d]);
+		}
+	      }
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+  unit_func("num_bytes_array");
+  unit_assert(bytes_match);
+
+  unit_func("face_to_array / array_to_face");
+  unit_assert(values_match);
+
+  delete field_data;
+  delete field_descr;
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -566,6 +566,57 @@ PARALLEL_MAIN_BEGIN
 
   hdf5_b.file_close();
 
+  //--------------------------------------------------
+  // Chunked, compressed, and truncated datasets
+  //--------------------------------------------------
+
+  unit_func("set_truncate_bits()");
+
+  for (int i=0; i<nx*ny; i++) {
+    a_double[i] = sin(0.1*i) * exp(0.01*i);
+    b_double[i] = 0.0;
+  }
+  const double a_double_0 = a_double[1];
+
+  const int truncate_bits = 32;
+
+  FileHdf5 hdf5_c("./","test_disk_truncate.h5");
+  hdf5_c.set_compress(4);
+  hdf5_c.set_chunk_size(16);
+  hdf5_c.set_truncate_bits(truncate_bits);
+  hdf5_c.file_create();
+  hdf5_c.mem_create(a_nx,a_ny,a_nz,a_nx,a_ny,a_nz,0,0,0);
+  hdf5_c.data_create ("double",type_double, a_nx,a_ny,a_nz,1);
+  hdf5_c.data_write (a_double);
+  hdf5_c.data_close ();
+  hdf5_c.file_close();
+
+  // the memory buffer is not modified
+  unit_assert (a_double[1] == a_double_0);
+
+  unit_func("bytes_written()");
+
+  unit_assert (hdf5_c.bytes_written() > 0);
+  unit_assert (hdf5_c.bytes_written() < (long long)(nx*ny*sizeof(double)));
+  unit_assert (hdf5_c.time_write() >= 0.0);
+
+  unit_func("set_truncate_bits() data match");
+
+  FileHdf5 hdf5_d("./","test_disk_truncate.h5");
+  hdf5_d.file_open();
+  hdf5_d.data_open ("double",&type, &b_nx,&b_ny,&b_nz);
+  hdf5_d.data_read (b_double);
+  hdf5_d.data_close ();
+  hdf5_d.file_close();
+
+  const double tolerance = std::pow(2.0,truncate_bits - 52);
+  bool p_truncate = true;
+  for (int i=0; i<nx*ny; i++) {
+    p_truncate = p_truncate &&
+      (std::abs(b_double[i] - a_double[i]) <= tolerance*std::abs(a_double[i]));
+  }
+  unit_assert (p_truncate);
+
   //--------------------------------------------------
   // Finalize
   //--------------------------------------------------
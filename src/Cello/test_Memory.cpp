@@ -239,12 +239,122 @@ PARALLEL_MAIN_BEGIN
   unit_assert(memory->num_delete() == del_count);
   CkPrintf ("inhibit optimize %d %d\n",memory->num_delete(), del_count);
 
+  //----------------------------------------------------------------------
+  // set_sampling()
+  //----------------------------------------------------------------------
+
+  unit_func ("new_group()");
+  const int index_test_1 = memory->index_group("Test_1");
+  const int index_test_2 = memory->index_group("Test_2");
+  unit_assert(memory->new_group("Test_1") == index_test_1);
+  unit_assert(memory->group_name(index_test_2) == "Test_2");
+
+  // allocations of at least sample_bytes are always recorded
+
+  unit_func ("set_sampling()");
+  memory->set_sampling(0,1000000);
+  unit_assert(memory->is_sampling());
+  memory->reset_sample();
+
+  memory->set_group("Test_2");
+  char * temp_2 = new char [2000000];
+  char * temp_3 = new char [100];
+  memory->set_group("");
+
+  unit_func ("sample_new_calls()");
+  unit_assert(memory->sample_new_calls(index_test_2) == 1);
+  unit_assert(memory->sample_new_calls(0) == 1);
+  unit_func ("sample_new_bytes()");
+  unit_assert(memory->sample_new_bytes(index_test_2) == 2000000);
+  unit_assert(memory->sample_new_bytes(0) == 2000000);
+
+  temp_2[0] = temp_3[0] = 'a';
+  CkPrintf ("inhibit__optimize %c %c\n",temp_2[0],temp_3[0]);
+  delete [] temp_2;
+  delete [] temp_3;
+
+  // every sample_interval'th allocation stands for sample_interval
+
+  memory->set_sampling(4,0);
+  memory->reset_sample();
+
+  memory->set_group("Test_1");
+  char * temp_4[8];
+  for (int k=0; k<8; k++) temp_4[k] = new char [10];
+  memory->set_group("");
+
+  unit_func ("sample_new_calls()");
+  unit_assert(memory->sample_new_calls(index_test_1) == 8);
+  unit_assert(memory->sample_new_calls(index_test_2) == 0);
+  unit_func ("sample_new_bytes()");
+  unit_assert(memory->sample_new_bytes(index_test_1) == 80);
+
+  for (int k=0; k<8; k++) delete [] temp_4[k];
+
+  unit_func ("reset_sample()");
+  memory->reset_sample();
+  unit_assert(memory->sample_new_calls(0) == 0);
+  unit_assert(memory->sample_new_bytes(index_test_1) == 0);
+
+  memory->set_sampling(0,0);
+  unit_assert(! memory->is_sampling());
+
   memory->print();
 #else /* CONFIG_USE_MEMORY */
   unit_func("CONFIG_USE_MEMORY");
   unit_assert(true);
 #endif/* CONFIG_USE_MEMORY */
 
+  //----------------------------------------------------------------------
+  // Workspace
+  //----------------------------------------------------------------------
+
+  unit_class("Workspace");
+
+  Workspace * workspace = Workspace::instance();
+
+  unit_func("allocate");
+
+  const int64_t num_new_0 = workspace->num_new();
+
+  double * w1 = workspace->allocate<double>(100);
+  int    * w2 = workspace->allocate<int>(17);
+  unit_assert (w1 != nullptr && w2 != nullptr);
+  unit_assert ((void *)w1 != (void *)w2);
+  unit_assert (workspace->num_active() == 2);
+  unit_assert (workspace->num_new() == num_new_0 + 2);
+  for (int i=0; i<100; i++) w1[i] = i;
+  for (int i=0; i<17; i++)  w2[i] = i;
+
+  unit_func("release");
+
+  workspace->release(w1);
+  workspace->release(w2);
+  unit_assert (workspace->num_active() == 0);
+
+  // same sizes again: steady state reuses arrays without allocating
+
+  const int64_t num_reuse_0 = workspace->num_reuse();
+  for (int cycle=0; cycle<10; cycle++) {
+    double * v1 = workspace->allocate<double>(100);
+    int    * v2 = workspace->allocate<int>(17);
+    workspace->release(v2);
+    workspace->release(v1);
+  }
+  unit_assert (workspace->num_new() == num_new_0 + 2);
+  unit_assert (workspace->num_reuse() == num_reuse_0 + 20);
+
+  // arrays of different types but equal size share the pool
+
+  float * w3 = workspace->allocate<float>(200);
+  unit_assert ((void *)w3 == (void *)w1);
+  workspace->release(w3);
+
+  unit_func("clear");
+
+  workspace->clear();
+  unit_assert (workspace->bytes() == 0);
+
   unit_finalize();
 
   exit_();
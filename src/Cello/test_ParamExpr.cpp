@@ -0,0 +1,231 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ParamExpr.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Test program for the ParamExpr class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "parameters.hpp"
+
+//----------------------------------------------------------------------
+
+struct node_expr * node_float (double value)
+{
+  struct node_expr * node = (struct node_expr *) calloc(1,sizeof(node_expr));
+  node->type = enum_node_float;
+  node->float_value = value;
+  return node;
+}
+
+struct node_expr * node_var (char var)
+{
+  struct node_expr * node = (struct node_expr *) calloc(1,sizeof(node_expr));
+  node->type = enum_node_variable;
+  node->var_value = var;
+  return node;
+}
+
+struct node_expr * node_op (int op, node_expr * left, node_expr * right)
+{
+  struct node_expr * node = (struct node_expr *) calloc(1,sizeof(node_expr));
+  node->type = enum_node_operation;
+  node->op_value = op;
+  node->left = left;
+  node->right = right;
+  return node;
+}
+
+struct node_expr * node_fun (const char * name, node_expr * arg)
+{
+  struct node_expr * node = (struct node_expr *) calloc(1,sizeof(node_expr));
+  node->type = enum_node_function;
+  node->fun_value = Param::function_map.at(name);
+  node->left = arg;
+  return node;
+}
+
+void node_free (struct node_expr * node)
+{
+  if (node == NULL) return;
+  node_free(node->left);
+  node_free(node->right);
+  free(node);
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ParamExpr");
+
+  //--------------------------------------------------
+  unit_func("constant folding");
+  //--------------------------------------------------
+
+  // sqrt(16.0) * 2.0 + 1.0
+
+  node_expr * tree_const = node_op
+    (enum_op_add,
+     node_op(enum_op_mul, node_fun("sqrt",node_float(16.0)), node_float(2.0)),
+     node_float(1.0));
+
+  ParamExpr expr_const (tree_const,false);
+
+  unit_assert (expr_const.is_constant());
+  unit_assert (expr_const.num_instructions() == 0);
+
+  double value_const[3];
+  expr_const.evaluate(value_const,3,nullptr,nullptr,nullptr,0.0);
+  unit_assert (value_const[0] == 9.0);
+  unit_assert (value_const[2] == 9.0);
+
+  // x + (2.0 * 3.0) only needs one instruction
+
+  node_expr * tree_x = node_op
+    (enum_op_add, node_var('x'),
+     node_op(enum_op_mul, node_float(2.0), node_float(3.0)));
+
+  ParamExpr expr_x (tree_x,false);
+
+  unit_assert (! expr_x.is_constant());
+  unit_assert (expr_x.num_instructions() == 1);
+
+  //--------------------------------------------------
+  unit_func("evaluate");
+  //--------------------------------------------------
+
+  // (x - y) * sin(z) + t^2 evaluated at more than one tile of points
+
+  node_expr * tree_float = node_op
+    (enum_op_add,
+     node_op(enum_op_mul,
+             node_op(enum_op_sub,node_var('x'),node_var('y')),
+             node_fun("sin",node_var('z'))),
+     node_op(enum_op_pow,node_var('t'),node_float(2.0)));
+
+  ParamExpr expr_float (tree_float,false);
+
+  const int n = 3*PARAM_EXPR_TILE + 7;
+  std::vector<double> x(n),y(n),z(n),value(n);
+  for (int i=0; i<n; i++) {
+    x[i] = 0.25*i;
+    y[i] = 1.0 - 0.5*i;
+    z[i] = 0.01*i;
+  }
+  const double t = 1.5;
+
+  expr_float.evaluate(value.data(),n,x.data(),y.data(),z.data(),t);
+
+  bool match = true;
+  for (int i=0; i<n; i++) {
+    const double v = (x[i]-y[i])*sin(z[i]) + pow(t,2.0);
+    match = match && (fabs(value[i]-v) <= 1e-14*(1.0+fabs(v)));
+  }
+  unit_assert (match);
+
+  //--------------------------------------------------
+  unit_func("evaluate grid");
+  //--------------------------------------------------
+
+  // evaluate on a grid with padded (strided) output and a mask
+
+  const int nx=13, ny=11, nz=5;
+  const int ndx=16, ndy=12, ndz=6;
+  std::vector<double> xv(nx),yv(ny),zv(nz);
+  for (int i=0; i<nx; i++) xv[i] = 0.1*i;
+  for (int i=0; i<ny; i++) yv[i] = 0.2*i;
+  for (int i=0; i<nz; i++) zv[i] = 0.3*i;
+
+  std::vector<float> value_grid(ndx*ndy*ndz,-1.0f);
+  bool * mask = new bool [nx*ny*nz];
+  for (int i=0; i<nx*ny*nz; i++) mask[i] = (i % 3 != 0);
+
+  expr_float.evaluate(value_grid.data(),t,
+                      ndx,nx,xv.data(),
+                      ndy,ny,yv.data(),
+                      ndz,nz,zv.data(),mask);
+
+  match = true;
+  for (int iz=0; iz<ndz; iz++) {
+    for (int iy=0; iy<ndy; iy++) {
+      for (int ix=0; ix<ndx; ix++) {
+        const int id = ix + ndx*(iy + ndy*iz);
+        const bool inside = (ix < nx && iy < ny && iz < nz);
+        const int i = ix + nx*(iy + ny*iz);
+        if (inside && mask[i]) {
+          const float v = (xv[ix]-yv[iy])*sin(zv[iz]) + pow(t,2.0);
+          match = match && (fabs(value_grid[id]-v) <= 1e-5*(1.0+fabs(v)));
+        } else {
+          match = match && (value_grid[id] == -1.0f);
+        }
+      }
+    }
+  }
+  unit_assert (match);
+
+  delete [] mask;
+
+  //--------------------------------------------------
+  unit_func("evaluate logical");
+  //--------------------------------------------------
+
+  // (x < y) || (z >= 0.5)
+
+  node_expr * tree_logical = node_op
+    (enum_op_or,
+     node_op(enum_op_lt,node_var('x'),node_var('y')),
+     node_op(enum_op_ge,node_var('z'),node_float(0.5)));
+
+  ParamExpr expr_logical (tree_logical,true);
+
+  bool * value_logical = new bool [n];
+  expr_logical.evaluate(value_logical,n,x.data(),y.data(),z.data(),t);
+
+  match = true;
+  for (int i=0; i<n; i++) {
+    match = match &&
+      (value_logical[i] == ((x[i] < y[i]) || (z[i] >= 0.5)));
+  }
+  unit_assert (match);
+
+  delete [] value_logical;
+
+  //--------------------------------------------------
+  unit_func("num_registers");
+  //--------------------------------------------------
+
+  // a long right-leaning chain x+(x+(x+...)) needs few registers
+
+  node_expr * tree_chain = node_var('x');
+  for (int i=0; i<64; i++) {
+    tree_chain = node_op(enum_op_add,node_var('x'),tree_chain);
+  }
+  ParamExpr expr_chain (tree_chain,false);
+  unit_assert (expr_chain.num_registers() <= 2);
+
+  double value_chain[2];
+  double x_chain[2] = { 1.0, 2.0 };
+  expr_chain.evaluate(value_chain,2,x_chain,nullptr,nullptr,0.0);
+  unit_assert (value_chain[0] == 65.0);
+  unit_assert (value_chain[1] == 130.0);
+
+  node_free(tree_const);
+  node_free(tree_x);
+  node_free(tree_float);
+  node_free(tree_logical);
+  node_free(tree_chain);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
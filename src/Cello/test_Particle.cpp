@@ -1029,6 +1029,104 @@ PARALLEL_MAIN_BEGIN
 
   unit_assert (error_gather_int == 0);
 
+  //--------------------------------------------------
+  // sort()
+  //--------------------------------------------------
+
+  {
+    ParticleData sort_data;
+    Particle p_sort (particle_descr,&sort_data);
+
+    const double lower[3] = {0.0, 0.0, 0.0};
+    const double upper[3] = {1.0, 1.0, 1.0};
+    const int n3[3] = {8, 8, 8};
+
+    // Morton key of a particle's cell, computed bit by bit
+    auto morton = [&] (double x, double y, double z) {
+      const int i3[3] = { int(n3[0]*x), int(n3[1]*y), int(n3[2]*z) };
+      uint64_t key = 0;
+      for (int bit=0; bit<21; bit++) {
+        for (int axis=0; axis<3; axis++) {
+          key |= uint64_t((i3[axis] >> bit) & 1) << (3*bit + axis);
+        }
+      }
+      return key;
+    };
+
+    // set positions pseudo-randomly in [0,1), and velocity_x to a
+    // function of position to check that attributes move together
+    auto assign = [&] (int i_first, int np) {
+      for (int i=i_first; i<i_first+np; i++) {
+        int ib,ip;
+        p_sort.index(i,&ib,&ip);
+        float  * x  = (float  *) p_sort.attribute_array(it_dark,ia_dark_x, ib);
+        float  * y  = (float  *) p_sort.attribute_array(it_dark,ia_dark_y, ib);
+        float  * z  = (float  *) p_sort.attribute_array(it_dark,ia_dark_z, ib);
+        double * vx = (double *) p_sort.attribute_array(it_dark,ia_dark_vx,ib);
+        const int dx = p_sort.stride(it_dark,ia_dark_x);
+        const int dv = p_sort.stride(it_dark,ia_dark_vx);
+        x[ip*dx] = float(((37*i) % 1009) / 1009.0);
+        y[ip*dx] = float(((53*i) % 1013) / 1013.0);
+        z[ip*dx] = float(((71*i) % 1019) / 1019.0);
+        vx[ip*dv] = x[ip*dx] + 2.0*y[ip*dx] + 4.0*z[ip*dx];
+      }
+    };
+
+    // check that particles are in Morton order with attributes intact
+    auto check = [&] (int * error_order, int * error_attribute) {
+      uint64_t key_last = 0;
+      for (int ib=0; ib<p_sort.num_batches(it_dark); ib++) {
+        float  * x  = (float  *) p_sort.attribute_array(it_dark,ia_dark_x, ib);
+        float  * y  = (float  *) p_sort.attribute_array(it_dark,ia_dark_y, ib);
+        float  * z  = (float  *) p_sort.attribute_array(it_dark,ia_dark_z, ib);
+        double * vx = (double *) p_sort.attribute_array(it_dark,ia_dark_vx,ib);
+        const int dx = p_sort.stride(it_dark,ia_dark_x);
+        const int dv = p_sort.stride(it_dark,ia_dark_vx);
+        for (int ip=0; ip<p_sort.num_particles(it_dark,ib); ip++) {
+          const uint64_t key = morton(x[ip*dx],y[ip*dx],z[ip*dx]);
+          if (key < key_last) ++(*error_order);
+          key_last = key;
+          if (vx[ip*dv] != x[ip*dx] + 2.0*y[ip*dx] + 4.0*z[ip*dx])
+            ++(*error_attribute);
+        }
+      }
+    };
+
+    assign (p_sort.insert_particles (it_dark, 5000), 5000);
+
+    unit_func("sort()");
+    unit_assert (p_sort.sort(it_dark,lower,upper,n3) > 0);
+    unit_assert (p_sort.num_particles(it_dark) == 5000);
+
+    int error_order = 0;
+    int error_attribute = 0;
+    check (&error_order,&error_attribute);
+    unit_assert (error_order == 0);
+    unit_assert (error_attribute == 0);
+
+    // sorting again is a no-op
+    unit_assert (p_sort.sort(it_dark,lower,upper,n3) == 0);
+
+    // deleting keeps the order
+    bool mask[mb];
+    for (int ip=0; ip<mb; ip++) mask[ip] = (ip % 3 == 0);
+    p_sort.delete_particles (it_dark,0,mask);
+    unit_assert (p_sort.sort(it_dark,lower,upper,n3) == 0);
+
+    // only the newly inserted particles are out of order
+    const int np_before = p_sort.num_particles(it_dark);
+    assign (p_sort.insert_particles (it_dark, 700), 700);
+    const int np_moved = p_sort.sort(it_dark,lower,upper,n3);
+    unit_assert (0 < np_moved && np_moved <= 700);
+    unit_assert (p_sort.num_particles(it_dark) == np_before + 700);
+
+    error_order = 0;
+    error_attribute = 0;
+    check (&error_order,&error_attribute);
+    unit_assert (error_order == 0);
+    unit_assert (error_attribute == 0);
+  }
+
   //--------------------------------------------------
   // data_size(), save_data(), load_data() 
   //--------------------------------------------------
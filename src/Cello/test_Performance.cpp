@@ -153,6 +153,76 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  unit_func("new_timer");
+
+  const int id_timer_1 = performance->new_timer("method_a");
+  const int id_timer_2 = performance->new_timer("solver_b");
+
+  unit_assert(performance->num_timers() == 2);
+  unit_assert(performance->new_timer("method_a") == id_timer_1);
+  unit_assert(performance->timer_index("solver_b") == id_timer_2);
+  unit_assert(performance->timer_index("unknown") == -1);
+  unit_assert(performance->timer_name(id_timer_1) == "method_a");
+
+  unit_func("timer_accumulate");
+
+  performance->timer_accumulate(id_timer_1, 1.0);
+  performance->timer_accumulate(id_timer_1, 3.0);
+  performance->timer_accumulate(id_timer_1, 2.0);
+
+  long long sum, count, min, max;
+  performance->timer_values(id_timer_1,&sum,&count,&min,&max);
+  unit_assert(sum   == 6000000);
+  unit_assert(count == 3);
+  unit_assert(min   == 1000000);
+  unit_assert(max   == 3000000);
+
+  performance->timer_values(id_timer_2,&sum,&count,&min,&max);
+  unit_assert(sum == 0 && count == 0 && min == 0 && max == 0);
+
+  unit_func("clear_timers");
+
+  performance->clear_timers();
+  performance->timer_values(id_timer_1,&sum,&count,&min,&max);
+  unit_assert(sum == 0 && count == 0 && min == 0 && max == 0);
+
+  //--------------------------------------------------
+
+  // sampled allocations are attributed to the innermost started region
+
+  Memory * memory = Memory::instance();
+  if (memory) {
+
+    memory->set_sampling(0,1);
+
+    const int index_group_1 = memory->index_group("region_1");
+    const int index_group_2 = memory->index_group("region_2");
+
+    unit_func("start_region");
+
+    performance->start_region(id_region_1);
+    unit_assert(memory->group_index() == index_group_1);
+    performance->start_region(id_region_2);
+    unit_assert(memory->group_index() == index_group_2);
+
+    unit_func("stop_region");
+
+    performance->stop_region(id_region_2);
+    unit_assert(memory->group_index() == index_group_1);
+
+    // regions stopped out of order
+
+    performance->start_region(id_region_2);
+    performance->stop_region(id_region_1);
+    unit_assert(memory->group_index() == index_group_2);
+    performance->stop_region(id_region_2);
+    unit_assert(memory->group_index() == 0);
+
+    memory->set_sampling(0,0);
+  }
+
   delete performance;
 
   unit_finalize();
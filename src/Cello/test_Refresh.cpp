@@ -51,6 +51,25 @@ PARALLEL_MAIN_BEGIN
 
   //--------------------------------------------------
 
+  unit_func ("aggregate()");
+  unit_assert (refresh->aggregate() == false);
+  refresh->set_aggregate(true);
+  unit_assert (refresh->aggregate() == true);
+
+  unit_func ("save_data()");
+  {
+    const int n = refresh->data_size();
+    char * buffer = new char [n];
+    unit_assert (refresh->save_data(buffer) == buffer + n);
+    Refresh refresh_copy;
+    unit_assert (refresh_copy.load_data(buffer) == buffer + n);
+    unit_assert (refresh_copy.aggregate() == true);
+    unit_assert (refresh_copy.ghost_depth() == 3);
+    delete [] buffer;
+  }
+
+  //--------------------------------------------------
+
   delete refresh;
 
   unit_finalize();
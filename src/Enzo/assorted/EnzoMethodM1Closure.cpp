@@ -49,6 +49,12 @@ EnzoMethodM1Closure::EnzoMethodM1Closure(ParameterGroup p)
     ir_injection_(-1),
     M1_tables(nullptr)
 {
+  // The global averages of the photon cross sections are reduced over
+  // all Blocks, which would deadlock on Blocks skipped between
+  // subcycled steps
+  ASSERT("EnzoMethodM1Closure::EnzoMethodM1Closure()",
+         "Method \"m1_closure\" is not supported with Stopping:subcycle = true",
+         ! cello::config()->stopping_subcycle);
 
   this->set_courant(p.value_float("courant",1.0));
 
@@ -766,21 +772,13 @@ void EnzoMethodM1Closure::compute_hll_eigenvalues (double f, double theta, doubl
 double EnzoMethodM1Closure::flux_function (double U_l, double U_lplus1,
 					    double Q_l, double Q_lplus1, double clight,
                                             double lmin, double lmax,  
-					    std::string type) throw()
+					    bool hll) throw()
 {
   // returns face-flux of a cell at index idx
-  if (type == "GLF") {
-    return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); 
-  }
-
-  else if (type == "HLL") {
+  if (hll) {
     return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin);
-  }
-
-  else {
-    ERROR("EnzoMethodM1Closure::flux_function",
-	     "flux_function type not recognized");
-    return 0.0; 
+  } else {
+    return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); 
   }
 }
 
@@ -789,12 +787,12 @@ double EnzoMethodM1Closure::flux_function (double U_l, double U_lplus1,
 double EnzoMethodM1Closure::deltaQ_faces (double U_l, double U_lplus1, double U_lminus1,
                                                   double Q_l, double Q_lplus1, double Q_lminus1,
                                                   double clight, double lmin, double lmax, 
-                                                  std::string flux_type) throw()
+                                                  bool hll) throw()
 {
   // calls flux_function(), and calculates Q_{i-1/2} - Q_{i+1/2}
   
-  return flux_function(U_lminus1, U_l     , Q_lminus1, Q_l     , clight, lmin, lmax, flux_type) - 
-         flux_function(U_l      , U_lplus1, Q_l      , Q_lplus1, clight, lmin, lmax, flux_type); 
+  return flux_function(U_lminus1, U_l     , Q_lminus1, Q_l     , clight, lmin, lmax, hll) - 
+         flux_function(U_l      , U_lplus1, Q_l      , Q_lplus1, clight, lmin, lmax, hll); 
 }
 
 //--------------------------------------------------------------------------
@@ -878,35 +876,32 @@ void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block,
 //--------------------------------------------------------------------------
 
 
-void EnzoMethodM1Closure::get_U_update (EnzoBlock * enzo_block, double * N_update, 
+void EnzoMethodM1Closure::get_U_update (double * N_update, 
                        double * Fx_update, double * Fy_update, double * Fz_update, 
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
+                       enzo_float * P[3][3], bool hll,
                        double hx, double hy, double hz, double dt, double clight, 
                        int i, int idx, int idy, int idz) throw()
 {
-  Field field = enzo_block->data()->field();
   // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
+  enzo_float * P00 = P[0][0];
   // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
+  enzo_float * P10 = P[1][0];
+  enzo_float * P01 = P[0][1];
+  enzo_float * P11 = P[1][1];
   // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
-
-  // if using HLL flux function, compute eigenvalues here
-  std::string flux_type = this->flux_function_;
+  enzo_float * P02 = P[0][2];
+  enzo_float * P12 = P[1][2];
+  enzo_float * P20 = P[2][0];
+  enzo_float * P21 = P[2][1];
+  enzo_float * P22 = P[2][2];
 
   // HLL min and max eigenvalues
   // +/- clight corresponds to GLF flux function
   double lmin_x = -1.0, lmin_y = -1.0, lmin_z = -1.0;
   double lmax_x =  1.0, lmax_y =  1.0, lmax_z =  1.0;
 
-  if (flux_type == "HLL") {
+  if (hll) {
     double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
     double f = std::min(Fnorm / (N[i]*clight), 1.0);
 
@@ -921,61 +916,61 @@ void EnzoMethodM1Closure::get_U_update (EnzoBlock * enzo_block, double * N_updat
   
   // if rank >= 1
   *N_update += dt/hx * deltaQ_faces( N[i],  N[i+idx],  N[i-idx],
-                                   Fx[i], Fx[i+idx], Fx[i-idx], clight, lmin_x, lmax_x, flux_type );
+                                   Fx[i], Fx[i+idx], Fx[i-idx], clight, lmin_x, lmax_x, hll );
     
   *Fx_update += dt/hx * deltaQ_faces(Fx[i], Fx[i+idx], Fx[i-idx],
                                    P00[i],
                                    P00[i+idx],
-                                   P00[i-idx], clight, lmin_x, lmax_x, flux_type );
+                                   P00[i-idx], clight, lmin_x, lmax_x, hll );
 
   // if rank >= 2
   *N_update += dt/hy * deltaQ_faces( N[i],  N[i+idy],  N[i-idy],
-                                   Fy[i], Fy[i+idy], Fy[i-idy], clight, lmin_y, lmax_y, flux_type );
+                                   Fy[i], Fy[i+idy], Fy[i-idy], clight, lmin_y, lmax_y, hll );
 
   *Fx_update += dt/hy * deltaQ_faces(Fx[i], Fx[i+idy], Fx[i-idy],
                                    P10[i],
                                    P10[i+idy],
-                                   P10[i-idy], clight, lmin_y, lmax_y, flux_type );
+                                   P10[i-idy], clight, lmin_y, lmax_y, hll );
 
   *Fy_update += dt/hx * deltaQ_faces(Fy[i], Fy[i+idx], Fy[i-idx],
                                    P01[i],
                                    P01[i+idx],
-                                   P01[i-idx], clight, lmin_x, lmax_x, flux_type );
+                                   P01[i-idx], clight, lmin_x, lmax_x, hll );
 
   *Fy_update += dt/hy * deltaQ_faces(Fy[i], Fy[i+idy], Fy[i-idy],
                                    P11[i],
                                    P11[i+idy],
-                                   P11[i-idy], clight, lmin_y, lmax_y, flux_type );
+                                   P11[i-idy], clight, lmin_y, lmax_y, hll );
 
 
    // if rank >= 3
   *N_update += dt/hz * deltaQ_faces( N[i],  N[i+idz],  N[i-idz],
-                                   Fz[i], Fz[i+idz], Fz[i-idz], clight, lmin_z, lmax_z, flux_type );
+                                   Fz[i], Fz[i+idz], Fz[i-idz], clight, lmin_z, lmax_z, hll );
 
   *Fx_update += dt/hz * deltaQ_faces(Fx[i], Fx[i+idz], Fx[i-idz],
                                    P20[i],
                                    P20[i+idz],
-                                   P20[i-idz], clight, lmin_z, lmax_z, flux_type );
+                                   P20[i-idz], clight, lmin_z, lmax_z, hll );
 
   *Fy_update += dt/hz * deltaQ_faces(Fy[i], Fy[i+idz], Fy[i-idz],
                                    P21[i],
                                    P21[i+idz],
-                                   P21[i-idz], clight, lmin_z, lmax_z, flux_type);
+                                   P21[i-idz], clight, lmin_z, lmax_z, hll);
 
   *Fz_update += dt/hx * deltaQ_faces(Fz[i], Fz[i+idx], Fz[i-idx],
                                    P02[i],
                                    P02[i+idx],
-                                   P02[i-idx], clight, lmin_x, lmax_x, flux_type);
+                                   P02[i-idx], clight, lmin_x, lmax_x, hll);
 
   *Fz_update += dt/hy * deltaQ_faces(Fz[i], Fz[i+idy], Fz[i-idy],
                                    P12[i],
                                    P12[i+idy],
-                                   P12[i-idy], clight, lmin_y, lmax_y, flux_type);
+                                   P12[i-idy], clight, lmin_y, lmax_y, hll);
 
   *Fz_update += dt/hz * deltaQ_faces(Fz[i], Fz[i+idz], Fz[i-idz],
                                    P22[i],
                                    P22[i+idz],
-                                   P22[i-idz], clight, lmin_z, lmax_z, flux_type);
+                                   P22[i-idz], clight, lmin_z, lmax_z, hll);
 
 }
 
@@ -1072,7 +1067,6 @@ void EnzoMethodM1Closure::get_photoionization_and_heating_rates (EnzoBlock * enz
   double Nunit = enzo_units->photon_number_density();
 
   Field field = enzo_block->data()->field();
-  Scalar<double> scalar = enzo_block->data()->scalar_double(); 
 
   int mx,my,mz;  
   field.dimensions(0,&mx, &my, &mz); //field dimensions, including ghost zones
@@ -1111,39 +1105,52 @@ void EnzoMethodM1Closure::get_photoionization_and_heating_rates (EnzoBlock * enz
     photon_densities.push_back( (enzo_float *) field.values("photon_density_" + std::to_string(igroup))) ;
   }
 
-  int N_species = 3; // HI, HeI, HeII
-  // loop through cells
-  for (int i=0; i<mx*my*mz; i++) {
-    double nHI = std::max(HI_density[i] * rhounit / mH, 1e-20); // cgs 
-    double heating_rate = 0.0; 
-    for (int j=0; j<N_species; j++) { //loop over species
-      double ionization_rate = 0.0;
-      for (int igroup=0; igroup<this->N_groups_; igroup++) { //loop over groups
-        double sigmaN = *(scalar.value( scalar.index( sigN_string(igroup,j) ))); // cm^2 
-        double sigmaE = *(scalar.value( scalar.index( sigE_string(igroup,j) ))); // cm^2
-        double eps    = *(scalar.value( scalar.index(  eps_string(igroup  ) ))); // erg 
-
-        double N_i = (photon_densities[igroup])[i] * Nunit; // cm^-3
-        double n_j = (chemistry_fields[j])[i] * rhounit / masses[j]; //number density of species j
-           
-        double ediff = eps*sigmaE - Eion[j]*sigmaN;
-            
-        ionization_rate += sigmaN*clight*N_i;
-        heating_rate    += std::max( n_j*clight*N_i*ediff, 0.0 ); // Equation A16
+  // gather cross sections once per block rather than once per cell
+  std::vector<double> sigN, sigE, eps;
+  get_cross_sections(enzo_block, sigN, sigE, eps);
+  const int N_species_scalar = 3 + this->H2_photodissociation_;
 
+  const int m = mx*my*mz;
+  std::vector<double> heating_rate(m, 0.0);
+  std::vector<double> ionization_rate(m);
+
+  int N_species = 3; // HI, HeI, HeII
+  for (int j=0; j<N_species; j++) { //loop over species
+    const enzo_float * density_j = chemistry_fields[j];
+    const double mass_j = masses[j];
+    std::fill(ionization_rate.begin(), ionization_rate.end(), 0.0);
+    for (int igroup=0; igroup<this->N_groups_; igroup++) { //loop over groups
+      const double sigmaN = sigN[igroup*N_species_scalar + j]; // cm^2
+      const double sigmaE = sigE[igroup*N_species_scalar + j]; // cm^2
+      const double ediff = eps[igroup]*sigmaE - Eion[j]*sigmaN;
+      const enzo_float * N_group = photon_densities[igroup];
+      // loop through cells
+      for (int i=0; i<m; i++) {
+        double N_i = N_group[i] * Nunit; // cm^-3
+        double n_j = density_j[i] * rhounit / mass_j; //number density of species j
+
+        ionization_rate[i] += sigmaN*clight*N_i;
+        heating_rate[i]    += std::max( n_j*clight*N_i*ediff, 0.0 ); // Equation A16
       }
-      (ionization_rate_fields[j])[i] = ionization_rate * tunit; //update fields with new value, put ionization rates in 1/time_units
     }
-        
-  RT_heating_rate[i] = heating_rate / nHI; // units of erg/s/cm^3/nHI
+    enzo_float * ionization_rate_j = ionization_rate_fields[j];
+    for (int i=0; i<m; i++) {
+      ionization_rate_j[i] = ionization_rate[i] * tunit; //update fields with new value, put ionization rates in 1/time_units
+    }
+  }
+
+  for (int i=0; i<m; i++) {
+    double nHI = std::max(HI_density[i] * rhounit / mH, 1e-20); // cgs 
+    RT_heating_rate[i] = heating_rate[i] / nHI; // units of erg/s/cm^3/nHI
   }
 
   // H2 photodissociation from LW radiation
   if (this->H2_photodissociation_) {
     enzo_float * RT_H2_photodissociation_rate = (enzo_float *) field.values("RT_H2_dissociation_rate");
-    for (int i=0; i<mx*my*mz; i++) {
-      double N = (photon_densities[0])[i] * Nunit; // LW-group assumed to be group 0
-      double sigmaN = *(scalar.value( scalar.index( sigN_string(0,3) ))); // cm^2 
+    const double sigmaN = sigN[3]; // cm^2; LW-group assumed to be group 0
+    const enzo_float * N_group = photon_densities[0];
+    for (int i=0; i<m; i++) {
+      double N = N_group[i] * Nunit;
       RT_H2_photodissociation_rate[i] = sigmaN*clight*N * tunit;
     }
   }
@@ -1241,16 +1248,24 @@ int EnzoMethodM1Closure::get_b_boolean (double E_lower, double E_upper, int spec
 
 //---------------------------------
 
-double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
-                                                enzo_float * T, int i, int igroup,
-                                                double E_lower, double E_upper) throw()
+void EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
+                                                enzo_float * T, int igroup,
+                                                double E_lower, double E_upper,
+                                                double * C) throw()
 {
   // update photon_density to account for recombination
   // 2nd half of eq 25, using backwards-in-time quantities for all variables.
-  // this is called once for each group.
+  // this is called once for each group, and fills C for the active cells.
 
   Field field = enzo_block->data()->field();
-  if (! field.is_field("density")) return 0.0;
+  int mx,my,mz;
+  field.dimensions(0,&mx, &my, &mz);
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx, &gy, &gz);
+
+  std::fill_n(C, mx*my*mz, 0.0);
+
+  if (! field.is_field("density")) return;
 
   EnzoUnits * enzo_units = enzo::units();
   double rhounit = enzo_units->density();
@@ -1264,36 +1279,47 @@ double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
 
   std::vector<double> masses = {mH,4*mH, 4*mH};
 
-  double C = 0.0;
   for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
-    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-     
     int b = get_b_boolean(E_lower, E_upper, j);
 
-    double alpha_A = get_alpha(T[i], j, 'A');  // cgs
-    double alpha_B = get_alpha(T[i], j, 'B');
+    // species whose recombination photons fall outside this group
+    // contribute nothing
+    if (b == 0) continue;
+
+    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
+    const double mass_j = masses[j];
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          int i = INDEX(ix,iy,iz,mx,my);
+
+          double alpha_A = get_alpha(T[i], j, 'A');  // cgs
+          double alpha_B = get_alpha(T[i], j, 'B');
 
-    double n_j = density_j[i]*rhounit/masses[j];
-    double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
+          double n_j = density_j[i]*rhounit/mass_j;
+          double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
 
-    C += b*(alpha_A-alpha_B) * n_j*n_e / Cunit;
+          C[i] += b*(alpha_A-alpha_B) * n_j*n_e / Cunit;
 
 #ifdef DEBUG_RECOMBINATION
-    CkPrintf("MethodM1Closure::C_add_recombination -- j=%d; alpha_A = %1.3e; alpha_B = %1.3e; n_j = %1.3e; n_e = %1.3e; b_boolean = %d\n", j, alpha_A, alpha_B, n_j, n_e, b);
+          CkPrintf("MethodM1Closure::C_add_recombination -- j=%d; alpha_A = %1.3e; alpha_B = %1.3e; n_j = %1.3e; n_e = %1.3e; b_boolean = %d\n", j, alpha_A, alpha_B, n_j, n_e, b);
 #endif
+        }
+      }
+    }
   }
 
 #ifdef DEBUG_RECOMBINATION
-  CkPrintf("MethodM1Closure::C_add_recombination -- [E_lower, E_upper] = [%.2f, %.2f]; dN_dt[i] = %1.3e; dt = %1.3e\n", E_lower, E_upper, C, enzo_block->dt);
+  CkPrintf("MethodM1Closure::C_add_recombination -- [E_lower, E_upper] = [%.2f, %.2f]; dt = %1.3e\n", E_lower, E_upper, enzo_block->dt);
 #endif 
-
-  return C;
 }
 
 //---------------------------------
 
-double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
-                                             double clight, int i, int igroup) throw()
+void EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
+                                              double clight, int igroup,
+                                              double * D) throw()
 {
   // Attenuate radiation
 
@@ -1302,8 +1328,14 @@ double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block,
   double tunit = enzo_units->time();
 
   Field field = enzo_block->data()->field();
+  int mx,my,mz;
+  field.dimensions(0,&mx, &my, &mz);
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx, &gy, &gz);
+
+  std::fill_n(D, mx*my*mz, 0.0);
 
-  if (! field.is_field("density")) return 0.0;
+  if (! field.is_field("density")) return;
  
   std::vector<std::string> chemistry_fields = {"HI_density", 
                                                "HeI_density", "HeII_density"};
@@ -1311,24 +1343,59 @@ double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block,
   double mH = enzo_constants::mass_hydrogen;
   std::vector<double> masses = {mH,4*mH, 4*mH};
  
-  Scalar<double> scalar = enzo_block->data()->scalar_double();
-  double D = 0.0;
+  std::vector<double> sigN, sigE, eps;
+  get_cross_sections(enzo_block, sigN, sigE, eps);
+  const int N_species_scalar = 3 + this->H2_photodissociation_;
+
   for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
     enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-    double n_j = density_j[i]*rhounit / masses[j];     
-    double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
-    
-    D += n_j * clight*sigN_ij * tunit; // code_time^-1
+    const double mass_j = masses[j];
+    const double sigN_ij = sigN[igroup*N_species_scalar + j];
 
-    #ifdef DEBUG_ATTENUATION
-      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; n_j=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, n_j, clight);
-    #endif
+#ifdef DEBUG_ATTENUATION
+    CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, clight);
+#endif
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          int i = INDEX(ix,iy,iz,mx,my);
+          double n_j = density_j[i]*rhounit / mass_j;     
+    
+          D[i] += n_j * clight*sigN_ij * tunit; // code_time^-1
+        }
+      }
+    }
   }
+}
 
-#ifdef DEBUG_ATTENUATION
-    CkPrintf("i=%d; D=%e s^-1; dt = %e\n",i, D / tunit, enzo_block->dt*enzo_units->time());
-#endif 
-  return D; 
+//---------------------------------
+
+void EnzoMethodM1Closure::get_cross_sections (EnzoBlock * enzo_block,
+                                              std::vector<double> & sigmaN,
+                                              std::vector<double> & sigmaE,
+                                              std::vector<double> & eps) throw()
+{
+  // look up each ScalarData index by name once, so that cell loops
+  // can read the cross sections from contiguous arrays
+
+  Scalar<double> scalar = enzo_block->data()->scalar_double();
+
+  const int N_groups  = this->N_groups_;
+  const int N_species = 3 + this->H2_photodissociation_;
+
+  sigmaN.resize(N_groups*N_species);
+  sigmaE.resize(N_groups*N_species);
+  eps.resize(N_groups);
+
+  for (int igroup=0; igroup<N_groups; igroup++) {
+    eps[igroup] = *(scalar.value( scalar.index( eps_string(igroup) ))); // erg
+    for (int j=0; j<N_species; j++) {
+      const int k = igroup*N_species + j;
+      sigmaN[k] = *(scalar.value( scalar.index( sigN_string(igroup,j) ))); // cm^2
+      sigmaE[k] = *(scalar.value( scalar.index( sigE_string(igroup,j) ))); // cm^2
+    }
+  }
 }
 
 //----------------------
@@ -1401,6 +1468,35 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
 
   //calculate the radiation pressure tensor
   get_pressure_tensor(enzo_block, N, Fx, Fy, Fz, clight_code);
+
+  enzo_float * P[3][3];
+  for (int j=0; j<3; j++) {
+    for (int k=0; k<3; k++) {
+      P[j][k] = (enzo_float *) field.values
+        ("P" + std::to_string(j) + std::to_string(k));
+    }
+  }
+
+  ASSERT1("EnzoMethodM1Closure::solve_transport_eqn",
+          "flux_function type \"%s\" not recognized",
+          this->flux_function_.c_str(),
+          (this->flux_function_ == "GLF" || this->flux_function_ == "HLL"));
+  const bool hll = (this->flux_function_ == "HLL");
+
+  // photon creation and destruction terms from interactions with matter
+  std::vector<double> C(m, 0.0);
+  std::vector<double> D(m, 0.0);
+
+  if (this->attenuation_) {
+    D_add_attenuation(enzo_block, clight_cgs, igroup, D.data());
+  }
+
+  if (this->recombination_radiation_) {
+    // update photon density due to recombinations
+    // Grackle does recombination chemistry, but doesn't
+    // do anything about the radiation that comes out of recombination
+    C_add_recombination(enzo_block, T, igroup, E_lower, E_upper, C.data());
+  }
   
   double Nmin = this->min_photon_density_ / Nunit;
 
@@ -1410,8 +1506,8 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
         int i = INDEX(ix,iy,iz,mx,my); //index of current cell
         double N_update=0, Fx_update=0, Fy_update=0, Fz_update=0;
       
-        get_U_update( enzo_block, &N_update, &Fx_update, &Fy_update, &Fz_update,
-                             N, Fx, Fy, Fz, hx, hy, hz, dt, clight_code,
+        get_U_update( &N_update, &Fx_update, &Fy_update, &Fz_update,
+                             N, Fx, Fy, Fz, P, hll, hx, hy, hz, dt, clight_code,
                              i, idx, idy, idz ); 
         
         // get updated fluxes
@@ -1428,25 +1524,9 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
       #endif
 
 
-        // add interactions with matter 
-
-        double C = 0.0; // photon creation term
-        double D = 0.0; // photon destruction term
-
-        if (this->attenuation_) {
-          D = D_add_attenuation(enzo_block, clight_cgs, i, igroup);
-        }
-
-        if (this->recombination_radiation_) {
-          // update photon density due to recombinations
-          // Grackle does recombination chemistry, but doesn't
-          // do anything about the radiation that comes out of recombination
-          C = C_add_recombination(enzo_block, T, i, igroup, E_lower, E_upper);
-        }
-        
         // update radiation fields due to thermochemistry (see appendix A)
-        double mult = 1.0/(1+dt*D);
-        Nnew [i] = std::max((Nnew [i] + dt*C) * mult, Nmin);
+        double mult = 1.0/(1+dt*D[i]);
+        Nnew [i] = std::max((Nnew [i] + dt*C[i]) * mult, Nmin);
         Fxnew[i] = Fxnew[i] * mult;
         Fynew[i] = Fynew[i] * mult;
         Fznew[i] = Fznew[i] * mult;
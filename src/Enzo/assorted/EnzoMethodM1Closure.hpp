@@ -203,15 +203,16 @@ protected: // methods
   //--------- TRANSPORT STEP --------
 
 
+  /// face flux: HLL if hll is true, otherwise GLF
   double flux_function (double U_l, double U_lplus1,
                         double Q_l, double Q_lplus1,
-                        double clight, double lmin, double lmax, std::string type) throw();
+                        double clight, double lmin, double lmax, bool hll) throw();
 
   void compute_hll_eigenvalues(double f, double theta, double * lmin, double * lmax, double clight) throw();
 
   double deltaQ_faces (double U_l, double U_lplus1, double U_lminus1, 
                        double Q_l, double Q_lplus1, double Q_lminus1,
-                       double clight, double lmin, double lmax, std::string flux_type) throw();
+                       double clight, double lmin, double lmax, bool hll) throw();
 
   void get_reduced_variables (double * chi_idx, double (*n_idx)[3], int i, double clight,
                               enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) 
@@ -221,9 +222,12 @@ protected: // methods
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
                        double clight) throw();
 
-  void get_U_update (EnzoBlock * enzo_block, double * N_update, 
+  /// computes the update of cell i given the radiation pressure tensor
+  /// fields P[j][k] = Pjk, using the HLL flux function if hll is true
+  void get_U_update (double * N_update, 
                        double * Fx_update, double * Fy_update, double * Fz_update, 
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
+                       enzo_float * P[3][3], bool hll,
                        double hx, double hy, double hz, double dt, double clight, 
                        int i, int idx, int idy, int idz) throw();
 
@@ -234,8 +238,18 @@ protected: // methods
   //---------- THERMOCHEMISTRY STEP ------------
   // Interaction with matter is completely local, so don't need a refresh before this step
 
-  /// computes the photon-loss term from attenuation by local gas
-  double D_add_attenuation ( EnzoBlock * enzo_block, double clight, int i, int igroup) throw(); 
+  /// gathers the group cross sections and mean energies stored as
+  /// ScalarData into dense arrays, with sigmaN and sigmaE indexed by
+  /// [igroup*N_species + j] and eps by [igroup]
+  void get_cross_sections (EnzoBlock * enzo_block,
+                           std::vector<double> & sigmaN,
+                           std::vector<double> & sigmaE,
+                           std::vector<double> & eps) throw();
+
+  /// computes the photon-loss term D from attenuation by local gas in
+  /// the active cells of the block
+  void D_add_attenuation ( EnzoBlock * enzo_block, double clight, int igroup,
+                           double * D) throw(); 
 
   /// helper function used in C_add_recombination
   double get_alpha (double T, int species, char rec_case) throw();
@@ -243,9 +257,11 @@ protected: // methods
   /// helper function used in C_add_recombination
   int get_b_boolean (double E_lower, double E_upper, int species) throw();
 
-  /// computes the photon-creation term from recombination in local gas
-  double C_add_recombination (EnzoBlock * enzo_block, 
-                              enzo_float * T, int i, int igroup, double E_lower, double E_uppe) throw();
+  /// computes the photon-creation term C from recombination in local gas
+  /// in the active cells of the block
+  void C_add_recombination (EnzoBlock * enzo_block, 
+                            enzo_float * T, int igroup, double E_lower, double E_upper,
+                            double * C) throw();
 
   /// Computes the photoionization cross-section of particles in a given gas
   /// species (specified by type) and for photons of energy E
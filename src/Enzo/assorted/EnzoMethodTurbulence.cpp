@@ -36,6 +36,12 @@ EnzoMethodTurbulence::EnzoMethodTurbulence
 {
   TRACE_TURBULENCE;
 
+  // The forcing normalization is reduced over all Blocks, which would
+  // deadlock on Blocks skipped between subcycled steps
+  ASSERT("EnzoMethodTurbulence::EnzoMethodTurbulence()",
+         "Method \"turbulence\" is not supported with Stopping:subcycle = true",
+         ! cello::config()->stopping_subcycle);
+
   const int rank = cello::rank();
 
   cello::define_field("density");
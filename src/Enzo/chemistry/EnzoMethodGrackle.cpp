@@ -437,6 +437,27 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodGrackle::supports_field_precision
+(const std::string & field_name) const throw()
+{
+  // species and metal densities are in the "color" group, and
+  // radiative transfer rates are prefixed by "RT_"
+  if (cello::field_groups()->is_in(field_name, "color")) return false;
+  if (field_name.compare(0, 3, "RT_") == 0) return false;
+  for (const std::string & name : {"density", "internal_energy",
+                                   "total_energy", "velocity_x",
+                                   "velocity_y", "velocity_z",
+                                   "bfield_x", "bfield_y", "bfield_z",
+                                   "cooling_time", "temperature",
+                                   "pressure", "dust_temperature",
+                                   "gamma"}) {
+    if (field_name == name) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodGrackle::timestep ( Block * block ) throw()
 {
   double dt = std::numeric_limits<double>::max();;
@@ -68,6 +68,15 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Fields passed to Grackle are accessed as gr_float (enzo_float)
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw();
+
+  /// Accelerations are not modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return field_name.compare(0, 13, "acceleration_") != 0; }
+
   /// returns the stored instance of GrackleChemistryData, if the simulation is
   /// configured to actually use grackle
   ///
@@ -83,6 +83,16 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       int has_history = ((field.num_history() > 0) &&
   			 (field.history_time(1) > 0.));
+
+      // old values are only used if saved for all fields involved
+      const char * history_fields[] =
+        { "density", "total_energy", "internal_energy",
+          "velocity_x", "velocity_y", "velocity_z" };
+      for (const char * name : history_fields) {
+        if (field.is_field(name) && ! field.has_history(name)) {
+          has_history = false;
+        }
+      }
       enzo_float compute_time;
       if (has_history) {
   	compute_time = 0.5 * (enzo_block->time() +
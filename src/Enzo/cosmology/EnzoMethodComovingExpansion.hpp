@@ -39,6 +39,11 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "comoving_expansion"; }
 
+  /// Accelerations are not modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return field_name.compare(0, 13, "acceleration_") != 0; }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
@@ -217,6 +217,9 @@ public: /// entry methods
   /// EnzoSolverBiCGStab entry method: DOT(V,R0), SUM(Y) and SUM(V)
   void r_solver_bicgstab_loop_5(CkReductionMsg* msg);
 
+  /// EnzoSolverBiCGStab entry method: refresh R and V (pipelined)
+  void p_solver_bicgstab_loop_5();
+
   /// EnzoSolverBiCGStab entry method: return from preconditioner
   void p_solver_bicgstab_loop_8();
 
@@ -250,6 +253,16 @@ public: /// entry methods
   void r_solver_dd_barrier(CkReductionMsg* msg);
   void r_solver_dd_end(CkReductionMsg* msg);
 
+  // EnzoSolverFft
+
+  void p_solver_fft_gather
+  (int index_solver, int level, int ic3[3], int n, double * a);
+  void p_solver_fft_forward
+  (int index_solver, int level, int order, int k, int n, double * a);
+  void p_solver_fft_backward
+  (int index_solver, int level, int j, int n, double * a);
+  void p_solver_fft_scatter (int index_solver, int n, double * a);
+
   // EnzoSolverJacobi
 
   void p_solver_jacobi_continue();
@@ -137,6 +137,10 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_dir(),
   method_check_monitor_iter(0),
   method_check_include_ghosts(false),
+  method_check_compress_level(0),
+  method_check_shuffle(true),
+  method_check_chunk_size(0),
+  method_check_max_queued(2),
   // EnzoInitialMergeSinksTest
   initial_merge_sinks_test_particle_data_filename(""),
   // EnzoInitialAccretionTest
@@ -174,6 +178,7 @@ EnzoConfig::EnzoConfig() throw ()
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
+  solver_pipelined(),
   solver_coarse_level(),
   solver_is_unigrid(),
   stopping_redshift()
@@ -334,6 +339,10 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_dir;
   p | method_check_monitor_iter;
   p | method_check_include_ghosts;
+  p | method_check_compress_level;
+  p | method_check_shuffle;
+  p | method_check_chunk_size;
+  p | method_check_max_queued;
 
   p | method_inference_level_base;
   p | method_inference_level_array;
@@ -371,6 +380,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_weight;
   p | solver_restart_cycle;
   p | solver_precondition;
+  p | solver_pipelined;
   p | solver_coarse_level;
   p | solver_is_unigrid;
 
@@ -890,6 +900,21 @@ void EnzoConfig::read_method_check_(Parameters * p)
   }
   method_check_monitor_iter   = p->value_integer("monitor_iter",0);
   method_check_include_ghosts = p->value_logical("include_ghosts",false);
+  method_check_compress_level = p->value_integer("compress_level",0);
+  method_check_shuffle        = p->value_logical("shuffle",true);
+  method_check_chunk_size     = p->value_integer("chunk_size",0);
+  method_check_max_queued     = p->value_integer("max_queued",2);
+
+  ASSERT1("EnzoConfig::read_method_check_",
+          "Method:check:compress_level %d must be between 0 and 9",
+          method_check_compress_level,
+          (0 <= method_check_compress_level &&
+           method_check_compress_level <= 9));
+
+  ASSERT1("EnzoConfig::read_method_check_",
+          "Method:check:max_queued %d must be at least 1",
+          method_check_max_queued,
+          (method_check_max_queued >= 1));
 }
 
 //----------------------------------------------------------------------
@@ -1405,6 +1430,7 @@ void EnzoConfig::read_solvers_(Parameters * p)
   solver_weight.      resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
+  solver_pipelined.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
 
@@ -1470,6 +1496,9 @@ void EnzoConfig::read_solvers_(Parameters * p)
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_pipelined[index_solver] =
+      p->value_logical (solver_name + ":pipelined",false);
+
   }
 }
 
@@ -188,6 +188,10 @@ public: // interface
       method_check_ordering("order_morton"),
       method_check_dir(),
       method_check_monitor_iter(0),
+      method_check_compress_level(0),
+      method_check_shuffle(true),
+      method_check_chunk_size(0),
+      method_check_max_queued(2),
       // EnzoMethodCheckGravity
       method_check_gravity_particle_type(),
       // EnzoMethodTurbulence
@@ -213,6 +217,7 @@ public: // interface
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
+      solver_pipelined(),
       solver_coarse_level(),
       solver_is_unigrid(),
       // EnzoStopping
@@ -454,6 +459,10 @@ public: // attributes
   std::vector<std::string>   method_check_dir;
   int                        method_check_monitor_iter;
   bool                       method_check_include_ghosts;
+  int                        method_check_compress_level;
+  bool                       method_check_shuffle;
+  int                        method_check_chunk_size;
+  int                        method_check_max_queued;
 
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
@@ -510,6 +519,9 @@ public: // attributes
   /// Solver index for Krylov solver preconditioner
   std::vector<int>           solver_precondition;
 
+  /// Whether to use the pipelined BiCgStab variant
+  std::vector<int>           solver_pipelined;
+
   /// Mg0 coarse grid solver
 
   std::vector<int>           solver_coarse_level;
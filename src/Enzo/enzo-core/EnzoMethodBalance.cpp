@@ -59,6 +59,23 @@ void EnzoMethodBalance::compute ( Block * block) throw()
   int index = *scalar.value(is_index);
   int ip_next = (long long) CkNumPes()*index/count;
 
+  // If the ordering method computed per-block costs, cut the ordering
+  // into equal cumulative cost instead of equal numbers of blocks
+
+  ScalarDescr * sd_cost = cello::scalar_descr_double();
+  const int is_cost_count = sd_cost->index("order_hilbert:cost_count") == -1 ? sd_cost->index("order_morton:cost_count") : sd_cost->index("order_hilbert:cost_count");
+  const int is_cost_index = sd_cost->index("order_hilbert:cost_index") == -1 ? sd_cost->index("order_morton:cost_index") : sd_cost->index("order_hilbert:cost_index");
+  if (is_cost_count != -1 && is_cost_index != -1) {
+    Scalar<double> scalar_cost(sd_cost,
+                               block->data()->scalar_data_double());
+    const double cost_count = *scalar_cost.value(is_cost_count);
+    const double cost_index = *scalar_cost.value(is_cost_index);
+    if (cost_count > 0.0) {
+      ip_next = (int) (CkNumPes()*cost_index/cost_count);
+      ip_next = std::max(0,std::min(ip_next,CkNumPes()-1));
+    }
+  }
+
   block->set_ip_next(ip_next);
 #ifdef TRACE_BALANCE
   CkPrintf ("self_balance %d %d %d %d\n", count, index,ip_next,CkMyPe());
@@ -41,6 +41,21 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "balance"; }
 
+  /// Does not access fields
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Contributes to reductions over all Blocks, so is only applied when
+  /// all levels are synchronized when subcycling
+  virtual bool is_synchronized () const throw()
+  { return true; }
+
 protected: // attributes
 
   /// Process to migrate to
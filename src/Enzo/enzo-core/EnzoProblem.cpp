@@ -422,7 +422,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_pipelined[index_solver]);
 
   } else if (solver_type == "diagonal") {
 
@@ -436,6 +437,20 @@ Solver * EnzoProblem::create_solver_
        index_prolong,
        index_restrict);
 
+  } else if (solver_type == "fft") {
+
+    solver = new EnzoSolverFft
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver]);
+
   } else if (solver_type == "jacobi") {
 
     solver = new EnzoSolverJacobi
@@ -710,7 +725,11 @@ Method * EnzoProblem::create_method_
        enzo_config->method_check_ordering,
        enzo_config->method_check_dir,
        enzo_config->method_check_monitor_iter,
-       enzo_config->method_check_include_ghosts);
+       enzo_config->method_check_include_ghosts,
+       enzo_config->method_check_compress_level,
+       enzo_config->method_check_shuffle,
+       enzo_config->method_check_chunk_size,
+       enzo_config->method_check_max_queued);
 
   } else if (name == "merge_sinks") {
 
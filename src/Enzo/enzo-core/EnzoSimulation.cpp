@@ -39,6 +39,9 @@ EnzoSimulation::EnzoSimulation
     check_num_files_(0),
     check_ordering_(""),
     check_directory_(),
+    check_writing_(false),
+    check_enter_pending_(false),
+    check_exit_count_(-1),
     restart_level_(0)
 {
 #ifdef CHECK_MEMORY
@@ -85,6 +88,7 @@ void EnzoSimulation::pup (PUP::er &p)
 
   p | sync_check_writer_created_;
   p | sync_check_done_;
+  p | sync_check_written_;
   p | sync_infer_count_;
   p | sync_infer_create_;
   p | sync_infer_done_;
@@ -92,6 +96,9 @@ void EnzoSimulation::pup (PUP::er &p)
   p | check_num_files_;
   p | check_ordering_;
   p | check_directory_;
+  p | check_writing_;
+  p | check_enter_pending_;
+  p | check_exit_count_;
   p | restart_level_;
 }
 
@@ -31,7 +31,12 @@ public: // functions
   ( const char parameter_file[], int n);
 
   /// CHARM++ Constructor
-  EnzoSimulation() : CBase_EnzoSimulation() {}
+  EnzoSimulation()
+    : CBase_EnzoSimulation(),
+      check_writing_(false),
+      check_enter_pending_(false),
+      check_exit_count_(-1)
+  {}
 
   /// CHARM++ Migration constructor
   EnzoSimulation(CkMigrateMessage * m) : CBase_EnzoSimulation(m)
@@ -66,6 +71,11 @@ public: // functions
   /// EnzoMethodCheck
   void r_method_check_enter (CkReductionMsg *);
   void p_check_done();
+  /// Count down checkpoint files closed by IoEnzoWriter
+  void p_check_written();
+  /// Return whether exiting must wait for checkpoint files to be
+  /// written, in which case Main::p_exit(count) is called when they are
+  bool check_defer_exit(int count);
   void p_set_io_reader(CProxy_IoEnzoReader proxy);
   void p_set_io_writer(CProxy_IoEnzoWriter proxy);
   void p_set_level_array(CProxy_EnzoLevelArray proxy);
@@ -107,6 +117,9 @@ private: // functions
 
   void infer_check_create_();
 
+  /// Begin writing a checkpoint
+  void check_enter_();
+
 private: // virtual functions
 
   virtual void initialize_config_() throw();
@@ -116,6 +129,7 @@ private: // attributes
   /// Checkpoint synchronization
   Sync                     sync_check_writer_created_;
   Sync                     sync_check_done_;
+  Sync                     sync_check_written_;
   /// Count root-level blocks before continuing in EnzoMethodInference
   Sync                     sync_infer_count_;
   /// Count inference arrays created
@@ -127,6 +141,12 @@ private: // attributes
   int                      check_num_files_;
   std::string              check_ordering_;
   std::vector<std::string> check_directory_;
+  /// Whether checkpoint files are still being written
+  bool                     check_writing_;
+  /// Whether the next checkpoint is waiting for files to be written
+  bool                     check_enter_pending_;
+  /// Main::p_exit() count waiting for files to be written, or -1
+  int                      check_exit_count_;
 
   /// Balance Method synchronization
   Sync sync_method_balance_;
@@ -275,6 +275,12 @@ PARALLEL_MAIN_BEGIN
   }
 #endif
 
+#ifdef CONFIG_USE_CKLOOP
+  // Use the worker PEs of each node for cello::parallel_for()
+  CkLoop_Init(-1);
+#endif
+  monitor_->print("Parallel","parallel_for threads %d",cello::num_threads());
+
  //--------------------------------------------------
 
   proxy_main     = thishandle;
@@ -53,6 +53,24 @@ void EnzoComputeTemperature::compute ( Block * block) throw()
   EnzoBlock * enzo_block = enzo::block(block);
   Field field = enzo_block->data()->field();
 
+  const int id_temperature = field.field_id("temperature");
+  if (id_temperature >= 0 &&
+      field.precision(id_temperature) != default_precision) {
+    // temperature stored at another precision: compute in enzo_float
+    // and convert
+    ASSERT ("EnzoComputeTemperature::compute()",
+            "temperature at non-default precision requires history 0",
+            i_hist_ == 0);
+    int mx,my,mz;
+    field.dimensions(id_temperature,&mx,&my,&mz);
+    Workspace * workspace = Workspace::instance();
+    enzo_float * t = workspace->allocate<enzo_float>(mx*my*mz);
+    compute(block, t);
+    field.values_from (id_temperature, t);
+    workspace->release(t);
+    return;
+  }
+
   enzo_float * t = field.is_field("temperature") ?
                     (enzo_float*) field.values("temperature", i_hist_) : NULL;
 
@@ -132,29 +132,28 @@ void EnzoComputeAcceleration::compute_(Block * block)
 
       const enzo_float fx = 1.0 / (2.0*hx);
       const enzo_float fy = 1.0 / (2.0*hy);
-      for (int iy=1; iy<my-1; iy++) {
+      cello::parallel_for (1, my-1, [&](int iy) {
 	for (int ix=1; ix<mx-1; ix++) {
 	  int i=ix + mx*iy;
 	  ax[i] = fx*(p[i+dx] - p[i-dx]);
 	  ay[i] = fy*(p[i+dy] - p[i-dy]);
 	}
-      }
+      });
 
     } else if (rank_ == 3) {
 
       const enzo_float fx = 1.0 / (2.0*hx);
       const enzo_float fy = 1.0 / (2.0*hy);
       const enzo_float fz = 1.0 / (2.0*hz);
-      for (int iz=1; iz<mz-1; iz++) {
-	for (int iy=1; iy<my-1; iy++) {
+      cello::parallel_for_rows
+        (1, mz-1, 1, my-1, [&](int iz, int iy) {
 	  for (int ix=1; ix<mx-1; ix++) {
 	    int i=ix + mx*(iy + my*iz);
 	    ax[i] = fx*(p[i+dx] - p[i-dx]);
 	    ay[i] = fy*(p[i+dy] - p[i-dy]);
 	    az[i] = fz*(p[i+dz] - p[i-dz]);
 	  }
-	}
-      }
+      });
     }
 
   } else if (order_ == 4) {
@@ -172,29 +171,28 @@ void EnzoComputeAcceleration::compute_(Block * block)
 
       const enzo_float fx = 1.0 / (12.0*hx);
       const enzo_float fy = 1.0 / (12.0*hy);
-      for (int iy=2; iy<my-2; iy++) {
+      cello::parallel_for (2, my-2, [&](int iy) {
 	for (int ix=2; ix<mx-2; ix++) {
 	  int i=ix + mx*iy;
 	  ax[i] = fx*( -p[i+dx2] + 8*p[i+dx] - 8*p[i-dx] + p[i-dx2]);
 	  ay[i] = fy*( -p[i+dy2] + 8*p[i+dy] - 8*p[i-dy] + p[i-dy2]);
 	}
-      }
+      });
 
     } else if (rank_ == 3) {
 
       const enzo_float fx = 1.0 / (12.0*hx);
       const enzo_float fy = 1.0 / (12.0*hy);
       const enzo_float fz = 1.0 / (12.0*hz);
-      for (int iz=2; iz<mz-2; iz++) {
-	for (int iy=2; iy<my-2; iy++) {
+      cello::parallel_for_rows
+        (2, mz-2, 2, my-2, [&](int iz, int iy) {
 	  for (int ix=2; ix<mx-2; ix++) {
 	    int i=ix + mx*(iy + my*iz);
 	    ax[i] = fx*( -p[i+dx2] + 8*p[i+dx] - 8*p[i-dx] + p[i-dx2]);
 	    ay[i] = fy*( -p[i+dy2] + 8*p[i+dy] - 8*p[i-dy] + p[i-dy2]);
 	    az[i] = fz*( -p[i+dz2] + 8*p[i+dz] - 8*p[i-dz] + p[i-dz2]);
 	  }
-	}
-      }
+      });
 
     }
 
@@ -28,6 +28,12 @@ EnzoMethodGravity::EnzoMethodGravity(ParameterGroup p, int index_solver,
     index_prolong_(index_prolong),
     dt_max_(p.value_float("dt_max",1.0e10))
 {
+  // The gravity solvers contribute to reductions over all leaf Blocks,
+  // which would deadlock on Blocks skipped between subcycled steps
+  ASSERT("EnzoMethodGravity::EnzoMethodGravity()",
+         "Method \"gravity\" is not supported with Stopping:subcycle = true",
+         ! cello::config()->stopping_subcycle);
+
   const bool accumulate = p.value_logical("accumulate",true);
 
   // Change this if fields used in this routine change
@@ -269,10 +275,49 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
   // Note density_total may not be defined
 
   enzo_float * B = (enzo_float*) field.values("B");
-  for (int i=0; i<m; i++) B[i] = 0.0;
-
   enzo_float * de_t = (enzo_float*) field.values("density_total");
-  if (de_t) for (int i=0; i<m; i++) de_t[i] = 0.0;
+
+  // Accelerations are not modified until the next solve, so the
+  // timestep candidate can be found in the same sweep, and equals
+  // timestep() unless it depends on the Block time (cosmology)
+
+  if (timestep_candidate_enabled() && ! cosmology) {
+
+    const int rank = cello::rank();
+    enzo_float * a3[3] =
+      { (enzo_float*) field.values ("acceleration_x"),
+        (enzo_float*) field.values ("acceleration_y"),
+        (enzo_float*) field.values ("acceleration_z") };
+
+    double a_mag_2_max = 0.0;
+    for (int iz=0; iz<mz; iz++) {
+      const bool is_active_z = (gz <= iz && iz < mz-gz);
+      for (int iy=0; iy<my; iy++) {
+        const bool is_active_zy = is_active_z && (gy <= iy && iy < my-gy);
+        for (int ix=0; ix<mx; ix++) {
+          const int i=ix + mx*(iy + iz*my);
+          if (is_active_zy && gx <= ix && ix < mx-gx) {
+            enzo_float a_mag_2 = 0.0;
+            for (int axis=0; axis<rank; axis++) {
+              a_mag_2 += a3[axis][i] * a3[axis][i];
+            }
+            a_mag_2_max = std::max(a_mag_2_max,a_mag_2);
+          }
+          B[i] = 0.0;
+          if (de_t) de_t[i] = 0.0;
+        }
+      }
+    }
+
+    set_timestep_candidate_
+      (enzo_block, timestep_from_acceleration_(enzo_block, a_mag_2_max));
+
+  } else {
+
+    for (int i=0; i<m; i++) B[i] = 0.0;
+    if (de_t) for (int i=0; i<m; i++) de_t[i] = 0.0;
+
+  }
 
 #ifdef DEBUG_COPY_POTENTIAL
   enzo_float * potential_copy = (enzo_float*) field.values ("potential_copy");
@@ -312,6 +357,42 @@ double EnzoMethodGravity::timestep_ (Block * block) throw()
 #endif  
 
   const int rank = cello::rank();
+
+  // Find th maximum of the square of the magnitude of acceleration
+  // across all active cells
+  
+  double a_mag_2_max = 0.0;
+  double a_mag_2;
+
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	int i=ix + mx*(iy + iz*my);
+#ifdef NEW_TIMESTEP
+	if (rank == 1) a_mag_2 = a3[0][i] * a3[0][i];
+	if (rank == 2) a_mag_2 = a3[0][i] * a3[0][i] + a3[1][i] * a3[1][i];
+	if (rank == 3) a_mag_2 = a3[0][i] * a3[0][i] + a3[1][i] * a3[1][i]
+			       + a3[2][i] * a3[2][i];
+#else
+	if (rank == 1) a_mag_2 = ax[i] * ax[i];
+	if (rank == 2) a_mag_2 = ax[i] * ax[i] + ay[i] * ay[i];
+	if (rank == 3) a_mag_2 = ax[i] * ax[i] + ay[i] * ay[i]
+			       + az[i] * az[i];
+#endif
+	a_mag_2_max = std::max(a_mag_2_max,a_mag_2);
+      }
+    }
+  }
+
+  return timestep_from_acceleration_(block, a_mag_2_max);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodGravity::timestep_from_acceleration_
+(Block * block, double a_mag_2_max) throw()
+{
+  const int rank = cello::rank();
   
   enzo_float dt = std::numeric_limits<enzo_float>::max();
 
@@ -362,32 +443,6 @@ double EnzoMethodGravity::timestep_ (Block * block) throw()
   
   const double epsilon = mean_cell_width / (dt_max_ * dt_max_);
 
-  // Find th maximum of the square of the magnitude of acceleration
-  // across all active cells, then get the square root of this value
-  
-  double a_mag_2_max = 0.0;
-  double a_mag_2;
-
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i=ix + mx*(iy + iz*my);
-#ifdef NEW_TIMESTEP
-	if (rank == 1) a_mag_2 = a3[0][i] * a3[0][i];
-	if (rank == 2) a_mag_2 = a3[0][i] * a3[0][i] + a3[1][i] * a3[1][i];
-	if (rank == 3) a_mag_2 = a3[0][i] * a3[0][i] + a3[1][i] * a3[1][i]
-			       + a3[2][i] * a3[2][i];
-#else
-	if (rank == 1) a_mag_2 = ax[i] * ax[i];
-	if (rank == 2) a_mag_2 = ax[i] * ax[i] + ay[i] * ay[i];
-	if (rank == 3) a_mag_2 = ax[i] * ax[i] + ay[i] * ay[i]
-			       + az[i] * az[i];
-#endif
-	a_mag_2_max = std::max(a_mag_2_max,a_mag_2);
-      }
-    }
-  }
-
   const double a_mag_max = sqrt(a_mag_2_max);
   dt = sqrt(mean_cell_width / (a_mag_max + epsilon)) ;
 
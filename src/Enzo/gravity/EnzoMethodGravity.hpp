@@ -79,6 +79,10 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep (Block * block) throw() ;
 
+  /// The timestep depends only on the accelerations
+  virtual std::vector<std::string> timestep_fields () const throw()
+  { return {"acceleration_x", "acceleration_y", "acceleration_z"}; }
+
   /// Compute accelerations from potential and exit solver
   void compute_accelerations (EnzoBlock * enzo_block) throw();
 
@@ -90,6 +94,11 @@ public: // interface
 
   /// Compute maximum timestep for this method
   double timestep_ (Block * block) throw() ;
+
+  /// Return the timestep given the maximum of the squared acceleration
+  /// magnitude over the Block's active cells
+  double timestep_from_acceleration_ (Block * block, double a_mag_2_max)
+    throw() ;
   
 protected: // attributes
 
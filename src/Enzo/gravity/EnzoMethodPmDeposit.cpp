@@ -36,7 +36,9 @@ extern "C" void  FORTRAN_NAME(dep_grid_cic)
 EnzoMethodPmDeposit::EnzoMethodPmDeposit (ParameterGroup p)
   : Method(),
     // read value from "Method:pm_deposit:alpha"
-    alpha_(p.value_float ("alpha",0.5))
+    alpha_(p.value_float ("alpha",0.5)),
+    // read value from "Method:pm_deposit:sort"
+    sort_(p.value_logical ("sort",false))
 {
   // Check if particle types in "is_gravitating" group have either a constant
   // or an attribute called "mass" (but not both).
@@ -93,12 +95,86 @@ void EnzoMethodPmDeposit::pup (PUP::er &p)
   Method::pup(p);
 
   p | alpha_;
+  p | sort_;
 }
 
 //----------------------------------------------------------------------
 
 namespace { // define local helper functions in anonymous namespace
 
+  /// Accumulates the CIC contributions of consecutive particles that
+  /// deposit into the same 2^rank cells, adding them to the density
+  /// array once per run rather than once per particle.  Runs are long
+  /// when particles are sorted by cell (see "Method:pm_deposit:sort"),
+  /// and have length one otherwise.
+  class DepositRun {
+
+  public:
+
+    DepositRun (enzo_float * de_p, Block * block, int rank, int mx, int my)
+      : de_p_(de_p), block_(block), mx_(mx), my_(my),
+        nc_(1 << rank), i0_(-1)
+    {
+      for (int k=0; k<8; k++) {
+        offset_[k] = (k & 1) + mx*(((k >> 1) & 1) + my*(k >> 2));
+        w_[k] = 0.0;
+      }
+    }
+
+    /// Add a particle with density pdens and CIC weights (x0,x1),
+    /// (y0,y1), (z0,z1) whose lowest deposit cell has index i0
+    void add (int i0, enzo_float pdens,
+              double x0, double x1, double y0, double y1,
+              double z0, double z1)
+    {
+      if (i0 != i0_) {
+        flush();
+        i0_ = i0;
+      }
+      const double wx[2] = {x0, x1};
+      const double wy[2] = {y0, y1};
+      const double wz[2] = {z0, z1};
+      for (int k=0; k<nc_; k++) {
+        w_[k] += pdens * wx[k & 1] * wy[(k >> 1) & 1] * wz[k >> 2];
+      }
+    }
+
+    /// Add the current run to the density array
+    void flush ()
+    {
+      if (i0_ < 0) return;
+      for (int k=0; k<nc_; k++) {
+        const int i = i0_ + offset_[k];
+        de_p_[i] += w_[k];
+        w_[k] = 0.0;
+        if (de_p_[i] < 0.0)
+          WARNING5("EnzoMethodPmDeposit",
+                   "Block %s: de_p[%d,%d,%d] = %g",
+                   block_->name().c_str(),
+                   i % mx_, (i / mx_) % my_, i / (mx_*my_), de_p_[i]);
+      }
+      i0_ = -1;
+    }
+
+  private:
+
+    enzo_float * de_p_;
+    Block * block_;
+    int mx_, my_;
+
+    /// Number of cells each particle deposits into
+    int nc_;
+
+    /// Index of the lowest cell of the current run, or -1 if none
+    int i0_;
+
+    /// Offsets of the deposit cells from i0_, and the run's sums
+    int offset_[8];
+    double w_[8];
+  };
+
+  //----------------------------------------------------------------------
+
   /// deposits mass from all gravitating particles onto density_particle_arr
   ///
   /// @param[out] density_particle_arr The array where the deposited mass
@@ -154,6 +230,10 @@ namespace { // define local helper functions in anonymous namespace
     // to zero.
     int dm;
 
+    // Contributions of consecutive particles in the same cell are
+    // summed before being added to de_p
+    DepositRun run (de_p, block, rank, mx, my);
+
     // Loop over particle types in "is_gravitating" group
     for (int ipt = 0; ipt < num_is_grav; ipt++) {
       const int it = particle.type_index(particle_groups->item("is_gravitating",ipt));
@@ -220,7 +300,6 @@ namespace { // define local helper functions in anonymous namespace
 	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
 
 	    int ix0 = gx + floor(tx);
-	    int ix1 = ix0 + 1;
 	    double x0 = 1.0 - (tx - floor(tx));
 	    double x1 = 1.0 - x0;
 
@@ -228,18 +307,7 @@ namespace { // define local helper functions in anonymous namespace
 	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
 	    // just dereferences pmass.
 	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0] += pdens * x0;
-	    de_p[ix1] += pdens * x1;
-
-	    if (de_p[ix0] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix0,de_p[ix0]);
-
-	    if (de_p[ix1] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix1,de_p[ix1]);
+	    run.add (ix0, pdens, x0, x1, 1.0, 0.0, 1.0, 0.0);
 
 	  } // Loop over particles in batch
 
@@ -267,8 +335,6 @@ namespace { // define local helper functions in anonymous namespace
 	    double ty = ny*(y - ym) / (yp - ym) - 0.5;
 	    int ix0 = gx + floor(tx);
 	    int iy0 = gy + floor(ty);
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
 	    double x0 = 1.0 - (tx - floor(tx));
 	    double y0 = 1.0 - (ty - floor(ty));
 	    double x1 = 1.0 - x0;
@@ -278,31 +344,7 @@ namespace { // define local helper functions in anonymous namespace
 	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
 	    // just dereferences pmass.
 	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*iy0] += pdens * x0 * y0;
-	    de_p[ix1+mx*iy0] += pdens * x1 * y0;
-	    de_p[ix0+mx*iy1] += pdens * x0 * y1;
-	    de_p[ix1+mx*iy1] += pdens * x1 * y1;
-
-	    if (de_p[ix0+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,de_p[ix0+mx*iy0]);
-
-	    if (de_p[ix1+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,de_p[ix1+mx*iy0]);
-
-	    if (de_p[ix0+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,de_p[ix0+mx*iy1]);
-
-	    if (de_p[ix1+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,de_p[ix1+mx*iy1]);
-
+	    run.add (ix0+mx*iy0, pdens, x0, x1, y0, y1, 1.0, 0.0);
 
 	  } // Loop over particles in batch
 
@@ -346,10 +388,6 @@ namespace { // define local helper functions in anonymous namespace
 	    int iy0 = gy + floor(ty);
 	    int iz0 = gz + floor(tz);
 
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
-	    int iz1 = iz0 + 1;
-
 	    double x0 = 1.0 - (tx - floor(tx));
 	    double y0 = 1.0 - (ty - floor(ty));
 	    double z0 = 1.0 - (tz - floor(tz));
@@ -362,62 +400,7 @@ namespace { // define local helper functions in anonymous namespace
 	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
 	    // just dereferences pmass.
 	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*(iy0+my*iz0)] += pdens * x0 * y0 * z0;
-	    de_p[ix1+mx*(iy0+my*iz0)] += pdens * x1 * y0 * z0;
-	    de_p[ix0+mx*(iy1+my*iz0)] += pdens * x0 * y1 * z0;
-	    de_p[ix1+mx*(iy1+my*iz0)] += pdens * x1 * y1 * z0;
-	    de_p[ix0+mx*(iy0+my*iz1)] += pdens * x0 * y0 * z1;
-	    de_p[ix1+mx*(iy0+my*iz1)] += pdens * x1 * y0 * z1;
-	    de_p[ix0+mx*(iy1+my*iz1)] += pdens * x0 * y1 * z1;
-	    de_p[ix1+mx*(iy1+my*iz1)] += pdens * x1 * y1 * z1;
-
-	    if (de_p[ix0+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz0,
-		       de_p[ix0+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz0,
-		       de_p[ix1+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz0,
-		       de_p[ix0+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz0,
-		       de_p[ix1+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz1,
-		       de_p[ix0+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz1,
-		       de_p[ix1+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz1,
-		       de_p[ix0+mx*(iy1+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz1,
-		       de_p[ix1+mx*(iy1+my*iz1)]);
+	    run.add (ix0+mx*(iy0+my*iz0), pdens, x0, x1, y0, y1, z0, z1);
 
 	  } // Loop over particles in batch
 	} // if rank == 3
@@ -426,6 +409,7 @@ namespace { // define local helper functions in anonymous namespace
 
     } // Loop over particle types in "is_gravitating" group
 
+    run.flush();
   }
 
   //----------------------------------------------------------------------
@@ -592,6 +576,31 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
       if (rank >= 2) inv_vol /= hy;
       if (rank >= 3) inv_vol /= hz;
 
+      if (sort_) {
+        // Sort by the lowest cell each particle deposits into, which
+        // is offset from the containing cell by half a cell width
+        Particle particle (block->data()->particle());
+        ParticleDescr * particle_descr = cello::particle_descr();
+        Grouping * particle_groups = particle_descr->groups();
+        double lower[3], upper[3];
+        block->lower(&lower[0],&lower[1],&lower[2]);
+        block->upper(&upper[0],&upper[1],&upper[2]);
+        const double h3[3] = {hx, hy, hz};
+        const int n3[3] = { mx - 2*gx,
+                            (rank >= 2) ? my - 2*gy : 1,
+                            (rank >= 3) ? mz - 2*gz : 1 };
+        for (int axis=0; axis<3; axis++) {
+          lower[axis] += 0.5*h3[axis];
+          upper[axis] += 0.5*h3[axis];
+        }
+        const int num_is_grav = particle_groups->size("is_gravitating");
+        for (int ipt = 0; ipt < num_is_grav; ipt++) {
+          const int it = particle.type_index
+            (particle_groups->item("is_gravitating",ipt));
+          particle.sort(it,lower,upper,n3);
+        }
+      }
+
       deposit_particles_(density_particle_arr, block, dt_div_cosmoa, inv_vol,
                          mx, my, mz,
                          gx, gy, gz);
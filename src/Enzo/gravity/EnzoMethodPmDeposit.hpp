@@ -25,7 +25,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPmDeposit (CkMigrateMessage *m)
     : Method (m),
-      alpha_(0.0)
+      alpha_(0.0),
+      sort_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +46,9 @@ protected: // attributes
   /// Deposit at time + alpha*dt
   double alpha_;
 
+  /// Whether to sort gravitating particles by cell before depositing
+  bool sort_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_PM_DEPOSIT_HPP */
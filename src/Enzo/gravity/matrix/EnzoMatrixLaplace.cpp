@@ -76,25 +76,24 @@ void EnzoMatrixLaplace::matvec_
       }
 
     } else if (rank == 2) {
-      for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for (g0, my_-g0, [&](int iy) {
 	for (int ix=g0; ix<mx_-g0; ix++) {
 	  const int i = ix + mx_*iy;
 	  Y[i] = ( X[i+idx] - 2.0*X[i] + X[i-idx]) * dx
 	    +    ( X[i+idy] - 2.0*X[i] + X[i-idy]) * dy;
 	}
-      }
+      });
 
     } else if (rank == 3) {
-      for     (int iz=g0; iz<mz_-g0; iz++) {
-	for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for_rows
+        (g0, mz_-g0, g0, my_-g0, [&](int iz, int iy) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
 	    Y[i] = ( X[i+idx] - 2.0*X[i] + X[i-idx]) * dx
 	      +    ( X[i+idy] - 2.0*X[i] + X[i-idy]) * dy
 	      +    ( X[i+idz] - 2.0*X[i] + X[i-idz]) * dz;
 	  }
-	}
-      }
+      });
     }
 
   } else if (order_ == 4) {
@@ -133,7 +132,7 @@ void EnzoMatrixLaplace::matvec_
 
     } else if (rank == 2) {
 
-      for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for (g0, my_-g0, [&](int iy) {
 	for (int ix=g0; ix<mx_-g0; ix++) {
 	  const int i = ix + mx_*iy;
 	  Y[i] = (c0*(X[i]) +
@@ -143,12 +142,12 @@ void EnzoMatrixLaplace::matvec_
 		  c1*(X[i-idy] +X[i+idy]) +
 		  c2*(X[i-idy2]+X[i+idy2])) * dy;
 	}
-      }
+      });
 
     } else if (rank == 3) {
 
-      for     (int iz=g0; iz<mz_-g0; iz++) {
-	for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for_rows
+        (g0, mz_-g0, g0, my_-g0, [&](int iz, int iy) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
 	    enzo_float * xp = X + i;
@@ -162,8 +161,7 @@ void EnzoMatrixLaplace::matvec_
 		    c1z*(xp[-idz] +xp[idz]) +
 		    c2z*(xp[-idz2]+xp[idz2]));
 	  }
-	}
-      }
+      });
     }
   } else if (order_ == 6) {
 
@@ -196,7 +194,7 @@ void EnzoMatrixLaplace::matvec_
 
     } else if (rank == 2) {
 
-      for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for (g0, my_-g0, [&](int iy) {
 	for (int ix=g0; ix<mx_-g0; ix++) {
 	  const int i = ix + mx_*iy;
 	  Y[i] = (c0*(X[i]) +
@@ -208,12 +206,12 @@ void EnzoMatrixLaplace::matvec_
 		  c2*(X[i-idy2]+X[i+idy2]) +
 		  c3*(X[i-idy3]+X[i+idy3])) * dy;
 	}
-      }
+      });
 
     } else if (rank == 3) {
 
-      for     (int iz=g0; iz<mz_-g0; iz++) {
-	for   (int iy=g0; iy<my_-g0; iy++) {
+      cello::parallel_for_rows
+        (g0, mz_-g0, g0, my_-g0, [&](int iz, int iy) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
 	    Y[i] = (c0*(X[i]) +
@@ -229,8 +227,7 @@ void EnzoMatrixLaplace::matvec_
 		    c2*(X[i-idz2]+X[i+idz2]) +
 		    c3*(X[i-idz3]+X[i+idz3])) * dz;
 	  }
-	}
-      }
+      });
     }
   } else {
     ERROR1 ("EnzoMatrixLaplace::diagonal()",
@@ -76,6 +76,10 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
+
+  /// Return the order of the operator
+  int order() const
+  { return order_; }
   
 public: // virtual functions
 
@@ -28,6 +28,25 @@
 /// LINE 15:     beta = (R*R0) / beta_n * (alpha/omega)
 /// LINE 16:     P = R + beta * (P - omega * V)
 /// LINE 17:  end for
+///
+/// If pipelined_ is true, DOT(R,R) and DOT(R,R0) for LINE 15 and
+/// the convergence test are not reduced separately.  Since R = Q -
+/// omega * U, they are computed from DOT(Q,Q), DOT(Q,R0), and
+/// DOT(U,R0), which are reduced together with DOT(U,Q) and DOT(U,U)
+/// for LINE 12:
+///
+///     R*R  = Q*Q - omega * (U*Q)
+///     R*R0 = Q*R0 - omega * (U*R0)
+///
+/// When R*R from this recurrence is not safely above the cancellation
+/// error in Q*Q (as near convergence), both are reduced explicitly.
+///
+/// Additionally, if there is no preconditioner (Y = Q in LINE 10),
+/// the ghost zones of Q are computed from those of R and V, which are
+/// refreshed while the DOT(V,R0) reduction for LINE 07 is in flight,
+/// rather than refreshing Y after LINE 08.  This leaves two global
+/// reductions and two refreshes per iteration, one of which overlaps
+/// a reduction.
 
 #include "Cello/cello.hpp"
 #include "Enzo/enzo.hpp"
@@ -208,7 +227,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ bool pipelined
  ) 
   : Solver(name,
 	   field_x,
@@ -230,7 +250,9 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     gx_(0), gy_(0), gz_(0),
     coarse_level_(coarse_level),
     ir_loop_3_(-1),
-    ir_loop_9_(-1)
+    ir_loop_9_(-1),
+    ir_loop_5_(-1),
+    pipelined_(pipelined)
 {
 
   // RESET restart_cycle TO 1 UNTIL CONVERGENCE
@@ -269,6 +291,14 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   is_us_ =     scalar_descr_quad->new_value("solver_bicgstab_us");
   is_qs_ =     scalar_descr_quad->new_value("solver_bicgstab_qs");
 
+  if (pipelined_) {
+    is_qq_ =   scalar_descr_quad->new_value("solver_bicgstab_qq");
+    is_qr0_ =  scalar_descr_quad->new_value("solver_bicgstab_qr0");
+    is_ur0_ =  scalar_descr_quad->new_value("solver_bicgstab_ur0");
+  } else {
+    is_qq_ = is_qr0_ = is_ur0_ = -1;
+  }
+
   if (solve_type == solve_tree) {
    
     ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
@@ -277,6 +307,13 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   } else {
     is_dot_sync_ = -1;
   }
+
+  if (is_overlapped_()) {
+    ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+    is_pipe_sync_ = scalar_descr_sync->new_value("solver_bicgstab_pipe_sync");
+  } else {
+    is_pipe_sync_ = -1;
+  }
   
   ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
   is_iter_ = scalar_descr_int->new_value("solver_bicgstab_iter");
@@ -330,6 +367,10 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | is_qs_;
     p | is_dot_sync_;
     p | is_iter_;
+    p | is_qq_;
+    p | is_qr0_;
+    p | is_ur0_;
+    p | is_pipe_sync_;
 
     p | res_tol_;
     p | index_precon_;
@@ -355,6 +396,8 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | coarse_level_;
     p | ir_loop_3_;
     p | ir_loop_9_;
+    p | ir_loop_5_;
+    p | pipelined_;
   }
 
 //----------------------------------------------------------------------
@@ -416,6 +459,12 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   /// initialize BiCgStab iteration counter
   (s_iter_(block)) = 0;
 
+  /// each iteration waits for both the DOT(V,R0) reduction and the
+  /// refresh of R and V before continuing with loop_7
+  if (is_overlapped_()) {
+    s_pipe_sync_(block) = 2;
+  }
+
   /// access field container on this block
 
   Field field = block->data()->field();
@@ -978,6 +1027,19 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
 
   }
 
+  if (is_overlapped_()) {
+
+    /// refresh R and V while DOT(V,R0) is reduced, continuing with
+    /// p_solver_bicgstab_loop_5()
+
+    Refresh * refresh = cello::refresh(ir_loop_5_);
+
+    refresh->set_active(is_finest_(block));
+
+    block->refresh_start
+      (ir_loop_5_, CkIndex_EnzoBlock::p_solver_bicgstab_loop_5());
+  }
+
   COPY_FIELD(block,"loop_4",iv_,"V1_bcg");
   /// compute local contributions to vr0_ = DOT(V, R0)
   
@@ -1079,6 +1141,39 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
   delete msg;
 
+  if (is_overlapped_() && ! s_pipe_sync_(block).next()) return;
+
+  loop_7(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_bicgstab_loop_5() {
+
+  TRACE_BCG(this,static_cast<EnzoSolverBiCgStab*> (solver()),"p_loop_5");
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverBiCgStab*> (solver())->loop_55(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::loop_55 (EnzoBlock * block) throw() {
+
+  TRACE_BCG(block,this,"loop_55");
+
+  if (s_pipe_sync_(block).next()) loop_7(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::loop_7(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"loop_7");
+
   const long double vr0 = S(vr0);
   const long double ys =  S(ys);
   const long double vs =  S(vs);
@@ -1131,6 +1226,9 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
     /// LINE 08: Q = R - alpha * V
     /// LINE 09: X = X + alpha * Y
+
+    /// (if overlapped, R and V ghost zones are up to date, so Q's
+    /// are as well)
     
     COPY_FIELD(block,"loop_6",ir_,"R1_bcg");
     enzo_float alpha = S(alpha);
@@ -1212,7 +1310,12 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
 
     for (int i=0; i<m_; i++)  Y[i] = Q[i];
 
-    loop_85(block);
+    /// skip refreshing Y if Q's ghost zones were computed in loop_7
+    if (is_overlapped_()) {
+      loop_10(block);
+    } else {
+      loop_85(block);
+    }
   }
 }
 
@@ -1279,10 +1382,12 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
   COPY_FIELD(block,"loop_10",iu_,"U");
 
+  const int n = pipelined_ ? 8 : 5;
+
   std::vector<long double> reduce;
-  reduce.resize(5+1);
+  reduce.resize(n+1);
   reduce.clear();
-  reduce[0] = 5;
+  reduce[0] = n;
   
   if (is_finest_(block)) {
     
@@ -1301,6 +1406,26 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 	}
       }
     }
+
+    if (pipelined_) {
+
+      enzo_float* R0 = (enzo_float*) field.values(ir0_);
+
+      /// qq_  = DOT(Q, Q)
+      /// qr0_ = DOT(Q, R0)
+      /// ur0_ = DOT(U, R0)
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    reduce[6] += Q[i]*Q[i];
+	    reduce[7] += Q[i]*R0[i];
+	    reduce[8] += U[i]*R0[i];
+	  }
+	}
+      }
+    }
   
     /// for singular Poisson problems, project both Y and U into R(A)
 
@@ -1329,12 +1454,17 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
   std::vector<int> is_array;
   if (solve_type_ == solve_tree) {
-    is_array.resize(5);
+    is_array.resize(n);
     is_array[0] = is_omega_n_;
     is_array[1] = is_omega_d_;
     is_array[2] = is_ys_;
     is_array[3] = is_us_;
     is_array[4] = is_qs_;
+    if (pipelined_) {
+      is_array[5] = is_qq_;
+      is_array[6] = is_qr0_;
+      is_array[7] = is_ur0_;
+    }
   }
 
 #ifdef DEBUG_REDUCE  
@@ -1355,7 +1485,7 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 #endif    
 
   TRACE_DOT(block,"start",3);
-  inner_product_(block,5,&reduce[0],is_array,callback,bcg_loop_12);
+  inner_product_(block,n,&reduce[0],is_array,callback,bcg_loop_12);
     
 }
 
@@ -1379,14 +1509,20 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
   if (solve_type_ != solve_tree && msg != NULL) {
     long double* data = (long double*) msg->getData();
-    ASSERT1("EnzoSolverBiCgStab::loop_12",
-	    "Expecting (data[0] = %Lg) == 5",
-	    data[0],(data[0] == 5));
+    const int n = pipelined_ ? 8 : 5;
+    ASSERT2("EnzoSolverBiCgStab::loop_12",
+	    "Expecting (data[0] = %Lg) == %d",
+	    data[0],n,(data[0] == n));
     S(omega_n) = data[1];
     S(omega_d) = data[2];
     S(ys)      = data[3];
     S(us)      = data[4];
     S(qs)      = data[5];
+    if (pipelined_) {
+      S(qq)  = data[6];
+      S(qr0) = data[7];
+      S(ur0) = data[8];
+    }
   }
 
   delete msg;
@@ -1477,6 +1613,36 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
   S(beta_d) = S(beta_n);
+
+  if (pipelined_) {
+
+    /// R = Q - omega * U, so with omega = (U*Q) / (U*U):
+    ///
+    ///   rr_    = DOT(R, R)  = DOT(Q,Q) - omega * DOT(U,Q)
+    ///   beta_n = DOT(R, R0) = DOT(Q,R0) - omega * DOT(U,R0)
+    ///
+    /// (for singular problems omega_n and omega_d include the
+    /// projection of U, and R0 has zero sum)
+    ///
+    /// The recurrence for rr_ cancels when R is small relative to Q,
+    /// and a negative or inaccurate rr_ would be taken as convergence,
+    /// so fall back to computing both dot products directly.  qq,
+    /// omega and omega_n are reduced values, so all Blocks take the
+    /// same branch.
+
+    const long double rr = S(qq) - S(omega)*S(omega_n);
+    const long double rr_min =
+      S(qq) * std::sqrt(std::numeric_limits<enzo_float>::epsilon());
+
+    if (rr > rr_min) {
+      S(rr)     = rr;
+      S(beta_n) = S(qr0) - S(omega)*S(ur0);
+
+      loop_14(block,nullptr);
+
+      return;
+    }
+  }
   
   /// rr_     = DOT(R, R)
   /// beta_n = DOT(R, R0)
@@ -1912,4 +2078,22 @@ void EnzoSolverBiCgStab::new_register_refresh_()
   
   refresh_loop_9->set_callback(CkIndex_EnzoBlock::p_solver_bicgstab_loop_9());
 
+  //--------------------------------------------------
+
+  if (is_overlapped_()) {
+
+    ir_loop_5_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_loop_5_,name()+":loop_5");
+
+    Refresh * refresh_loop_5 = cello::refresh(ir_loop_5_);
+
+    if (solve_type_ == solve_tree)
+      refresh_loop_5->set_root_level (coarse_level_);
+
+    refresh_loop_5->add_field (ir_);
+    refresh_loop_5->add_field (iv_);
+
+    refresh_loop_5->set_callback(CkIndex_EnzoBlock::p_solver_bicgstab_loop_5());
+  }
+
 }
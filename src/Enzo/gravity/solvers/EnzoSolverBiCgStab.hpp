@@ -8,6 +8,13 @@
 ///
 /// Bicongugate gradient stabilized solver (BiCgStab) for solving 
 /// linear systems on field data.
+///
+/// If "pipelined" is set, the solver uses a communication-reduced
+/// variant with two global reductions per iteration instead of
+/// three: DOT(R,R) and DOT(R,R0) are computed from dot products
+/// fused into the DOT(U,Q), DOT(U,U) reduction.  Without a
+/// preconditioner, the refresh of Q is also replaced by a refresh of
+/// R and V that overlaps the DOT(V,R0) reduction.
 
 #ifndef ENZO_ENZO_SOLVER_BICGSTAB_HPP
 #define ENZO_ENZO_SOLVER_BICGSTAB_HPP
@@ -50,7 +57,8 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     bool pipelined = false);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -62,6 +70,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_qq_(-1),     is_qr0_(-1),     is_ur0_(-1),      is_pipe_sync_(-1),
       res_tol_(0),
       index_precon_(-1),
       iter_max_(-1),
@@ -77,7 +86,9 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      ir_loop_5_(-1),
+      pipelined_(false)
   {};
 
   /// Charm++ PUP::able declarations
@@ -93,6 +104,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_qq_(-1),     is_qr0_(-1),     is_ur0_(-1),      is_pipe_sync_(-1),
       res_tol_(0.0),
       index_precon_(-1),
       iter_max_(0), 
@@ -102,7 +114,9 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      ir_loop_5_(-1),
+      pipelined_(false)
           
   {}
 
@@ -136,9 +150,16 @@ public: // interface
   /// Y and V
   void loop_4(EnzoBlock* enzo_block) throw();
 
-  /// Shifts Y and V, begins, first vector updates, begins refresh on Q
+  /// Receives DOT(V,R0), SUM(Y) and SUM(V), and continues with
+  /// loop_7 (when pipelined, after the refresh of R and V completes)
   void loop_6(EnzoBlock* enzo_block, CkReductionMsg *) throw();
 
+  /// Return from refresh of R and V when pipelined
+  void loop_55(EnzoBlock* enzo_block) throw();
+
+  /// Shifts Y and V, first vector updates
+  void loop_7(EnzoBlock* enzo_block) throw();
+
   /// Second preconditioner solve, begins refresh on Y
   void loop_8(EnzoBlock* enzo_block) throw();
 
@@ -150,7 +171,8 @@ public: // interface
   void loop_10(EnzoBlock* enzo_block) throw();
 
   /// Shifts Y and U, second vector updates, begins DOT(R,R) and
-  /// DOT(R,R0)
+  /// DOT(R,R0) (when pipelined, computes them from the fused dot
+  /// products instead)
   void loop_12(EnzoBlock* enzo_block, CkReductionMsg * ) throw();
 
   /// Updates search direction, begins update on iteration counter
@@ -237,6 +259,14 @@ protected:
   Sync & s_dot_sync_(EnzoBlock * block)
   { return *block->data()->scalar_sync().value(is_dot_sync_); }
 
+  Sync & s_pipe_sync_(EnzoBlock * block)
+  { return *block->data()->scalar_sync().value(is_pipe_sync_); }
+
+  /// Whether the refresh of Q is replaced by a refresh of R and V
+  /// overlapping the DOT(V,R0) reduction
+  bool is_overlapped_() const
+  { return pipelined_ && (index_precon_ < 0); }
+
   int & s_iter_(EnzoBlock * block)
   { return *block->data()->scalar_int().value(is_iter_); }
 
@@ -276,6 +306,14 @@ protected: // attributes
   int is_dot_sync_;
   int is_iter_;
 
+  /// Fused dot products DOT(Q,Q), DOT(Q,R0), DOT(U,R0) if pipelined
+  int is_qq_;
+  int is_qr0_;
+  int is_ur0_;
+
+  /// Sync joining the DOT(V,R0) reduction and R,V refresh if pipelined
+  int is_pipe_sync_;
+
   /// Convergence tolerance on the relative residual
   double res_tol_;
 
@@ -305,6 +343,10 @@ protected: // attributes
   /// Refresh id's
   int ir_loop_3_;
   int ir_loop_9_;
+  int ir_loop_5_;
+
+  /// Whether to use the communication-reduced (pipelined) variant
+  bool pipelined_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_BICGSTAB_HPP */
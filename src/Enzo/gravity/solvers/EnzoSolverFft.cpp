@@ -0,0 +1,670 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    Implements the EnzoSolverFft class
+///
+/// Control flow, with "level" the solve level max_level_:
+///
+///   apply()                      [all Blocks]
+///      if level != block level: end
+///      slab(block).p_solver_fft_gather(B)
+///
+///   gather_recv()                [slab owners]
+///      unpack B into real slab
+///      if all Blocks in slab received: slab_forward_()
+///
+///   slab_forward_()
+///      FFT along x (real-to-complex) and y (3D)
+///      for pencil j: pencil(j).p_solver_fft_forward(slab part j)
+///
+///   forward_recv()               [pencil owners]
+///      unpack slab part into pencil
+///      if all slabs received: pencil_solve_()
+///
+///   pencil_solve_()
+///      FFT along last axis, divide by eigenvalues, inverse FFT
+///      for slab k: slab(k).p_solver_fft_backward(pencil part k)
+///
+///   backward_recv()              [slab owners]
+///      unpack pencil part into slab
+///      if all pencils received: slab_backward_()
+///
+///   slab_backward_()
+///      inverse FFT along y (3D) and x (complex-to-real)
+///      for Block in slab: block.p_solver_fft_scatter(X)
+///
+///   scatter_recv()               [all Blocks in level]
+///      unpack X
+///      end
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+//----------------------------------------------------------------------
+
+/// Copy the box with extents e3 from offset s3 in array src (extents
+/// ns3) to offset d3 in array dst (extents nd3)
+template <class T, class U>
+static void copy_box_
+(T * dst, const int nd3[3], const int d3[3],
+ const U * src, const int ns3[3], const int s3[3],
+ const int e3[3])
+{
+  for (int iz=0; iz<e3[2]; iz++) {
+    for (int iy=0; iy<e3[1]; iy++) {
+      T * d = dst + d3[0] + nd3[0]*((d3[1]+iy) + nd3[1]*(d3[2]+iz));
+      const U * s = src + s3[0] + ns3[0]*((s3[1]+iy) + ns3[1]*(s3[2]+iz));
+      for (int ix=0; ix<e3[0]; ix++) d[ix] = s[ix];
+    }
+  }
+}
+
+//======================================================================
+
+EnzoSolverFft::EnzoSolverFft
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int min_level,
+ int max_level) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+	   index_prolong,
+	   index_restrict,
+	   min_level,
+	   max_level),
+    order_(0),
+    is_sync_slab_(-1),
+    is_sync_pencil_(-1),
+    iv_real_(-1),
+    iv_slab_(-1),
+    iv_pencil_(-1),
+    fft_()
+{
+  ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+  is_sync_slab_   = scalar_descr_sync->new_value(name + ":slab");
+  is_sync_pencil_ = scalar_descr_sync->new_value(name + ":pencil");
+
+  ScalarDescr * scalar_descr_void = cello::scalar_descr_void();
+  iv_real_   = scalar_descr_void->new_value(name + ":real");
+  iv_slab_   = scalar_descr_void->new_value(name + ":slab");
+  iv_pencil_ = scalar_descr_void->new_value(name + ":pencil");
+}
+
+//======================================================================
+
+void EnzoSolverFft::apply
+( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  const int level = max_level_;
+
+  ASSERT2 ("EnzoSolverFft::apply()",
+	   "Solver %s requires max_level %d <= 0 so that the level is complete",
+	   name_.c_str(),level,
+	   (level <= 0));
+
+  if (block->level() != level) {
+    Solver::end_(block);
+    return;
+  }
+
+  std::shared_ptr<EnzoMatrixLaplace> laplace =
+    std::dynamic_pointer_cast<EnzoMatrixLaplace>(A);
+
+  ASSERT1 ("EnzoSolverFft::apply()",
+	   "Solver %s requires an EnzoMatrixLaplace matrix",
+	   name_.c_str(),
+	   (laplace != nullptr));
+
+  order_ = laplace->order();
+
+  geometry_(block,level);
+
+  int p3[3] = {1,1,1};
+  cello::hierarchy()->get_periodicity(&p3[0],&p3[1],&p3[2]);
+  for (int axis=0; axis<rank_; axis++) {
+    ASSERT2 ("EnzoSolverFft::apply()",
+	     "Solver %s requires periodic boundaries, but axis %d is not",
+	     name_.c_str(),axis,
+	     (p3[axis] != 0));
+  }
+
+  // Copy B interior and send it to the slab owner
+
+  Field field = block->data()->field();
+
+  int m3[3], g3[3];
+  field.dimensions (ib_,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth(ib_,&g3[0],&g3[1],&g3[2]);
+
+  const enzo_float * B = (enzo_float*) field.values(ib_);
+
+  const int n = n3_[0]*n3_[1]*n3_[2];
+  std::vector<double> buffer(n);
+  const int zero3[3] = {0,0,0};
+  copy_box_(buffer.data(),n3_,zero3, B,m3,g3, n3_);
+
+  int ic3[3], nc3[3];
+  block->index_global(&ic3[0],&ic3[1],&ic3[2],&nc3[0],&nc3[1],&nc3[2]);
+
+  int is3[3] = {0,0,0};
+  if (rank_ >= 2) is3[a_] = ic3[a_];
+
+  enzo::block_array()[index_block_(level,is3[0],is3[1],is3[2])].
+    p_solver_fft_gather (index_,level,ic3,n,buffer.data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_gather
+(int index_solver, int level, int ic3[3], int n, double * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverFft * solver =
+    static_cast<EnzoSolverFft*> (cello::solver(index_solver));
+
+  solver->gather_recv(this,level,ic3,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::gather_recv
+(EnzoBlock * block, int level, int ic3[3], int n, double * a) throw()
+{
+  // May be called before this Block has entered the solver
+
+  geometry_(block,level);
+
+  int s3[3] = {N3_[0],N3_[1],N3_[2]};
+  if (rank_ >= 2) s3[a_] = n3_[a_];
+
+  std::vector<double> * real =
+    buffer_<double>(block,iv_real_,s3[0]*s3[1]*s3[2]);
+
+  int o3[3] = {ic3[0]*n3_[0], ic3[1]*n3_[1], ic3[2]*n3_[2]};
+  if (rank_ >= 2) o3[a_] = 0;
+
+  const int zero3[3] = {0,0,0};
+  copy_box_(real->data(),s3,o3, a,n3_,zero3, n3_);
+
+  const int num_slabs = (rank_ >= 2) ? nb3_[a_] : 1;
+
+  Sync * sync = psync_slab_(block);
+  sync->set_stop(nb3_[0]*nb3_[1]*nb3_[2]/num_slabs);
+  if (sync->next()) slab_forward_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::slab_forward_(EnzoBlock * block) throw()
+{
+  int s3[3] = {N3_[0],N3_[1],N3_[2]};
+  if (rank_ >= 2) s3[a_] = n3_[a_];
+  const int c3[3] = {K0_,s3[1],s3[2]};
+
+  std::vector<double> * real =
+    buffer_<double>(block,iv_real_,s3[0]*s3[1]*s3[2]);
+  std::vector<complex_type> * slab =
+    buffer_<complex_type>(block,iv_slab_,c3[0]*c3[1]*c3[2]);
+
+  // Real-to-complex transform along x, two rows at a time
+
+  const int num_rows = s3[1]*s3[2];
+  const double * x = real->data();
+  complex_type * y = slab->data();
+  const Fft & fft_x = *fft_[0];
+  cello::parallel_for (0, (num_rows+1)/2, [&](int ip) {
+      const int i0 = 2*ip;
+      const int i1 = 2*ip + 1;
+      const bool pair = (i1 < num_rows);
+      fft_x.forward_real (x + i0*s3[0], pair ? x + i1*s3[0] : nullptr,
+			  y + i0*c3[0], pair ? y + i1*c3[0] : nullptr);
+    });
+
+  delete_buffer_<double>(block,iv_real_);
+
+  if (rank_ == 3) transform_lines_(slab->data(),c3,1,-1);
+
+  if (rank_ == 1) {
+    // single slab holds the whole level
+    const int k3[3] = {0,0,0};
+    divide_eigenvalues_(slab->data(),k3,c3,order_);
+    slab_backward_(block);
+    return;
+  }
+
+  // Send slab parts to pencil owners
+
+  const int level = block->level();
+
+  int ic3[3], nc3[3];
+  block->index_global(&ic3[0],&ic3[1],&ic3[2],&nc3[0],&nc3[1],&nc3[2]);
+  const int k = ic3[a_];
+
+  for (int j=0; j<nb3_[b_]; j++) {
+
+    int k0,k1;
+    pencil_range_(j,&k0,&k1);
+
+    int e3[3] = {c3[0],c3[1],c3[2]};
+    e3[b_] = k1 - k0;
+    int o3[3] = {0,0,0};
+    o3[b_] = k0;
+
+    std::vector<complex_type> buffer(e3[0]*e3[1]*e3[2]);
+    const int zero3[3] = {0,0,0};
+    copy_box_(buffer.data(),e3,zero3, slab->data(),c3,o3, e3);
+
+    int ip3[3] = {0,0,0};
+    ip3[b_] = j;
+
+    enzo::block_array()[index_block_(level,ip3[0],ip3[1],ip3[2])].
+      p_solver_fft_forward (index_,level,order_,k,
+			    2*buffer.size(),(double *)buffer.data());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_forward
+(int index_solver, int level, int order, int k, int n, double * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverFft * solver =
+    static_cast<EnzoSolverFft*> (cello::solver(index_solver));
+
+  solver->forward_recv(this,level,order,k,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::forward_recv
+(EnzoBlock * block, int level, int order, int k, int n, double * a) throw()
+{
+  // May be called before this Block has entered the solver
+
+  geometry_(block,level);
+
+  int ic3[3], nc3[3];
+  block->index_global(&ic3[0],&ic3[1],&ic3[2],&nc3[0],&nc3[1],&nc3[2]);
+  const int j = ic3[b_];
+
+  int k0,k1;
+  pencil_range_(j,&k0,&k1);
+
+  int q3[3] = {K0_,N3_[1],N3_[2]};
+  q3[b_] = k1 - k0;
+
+  std::vector<complex_type> * pencil =
+    buffer_<complex_type>(block,iv_pencil_,q3[0]*q3[1]*q3[2]);
+
+  int e3[3] = {q3[0],q3[1],q3[2]};
+  e3[a_] = n3_[a_];
+  int o3[3] = {0,0,0};
+  o3[a_] = k*n3_[a_];
+
+  const int zero3[3] = {0,0,0};
+  copy_box_(pencil->data(),q3,o3, (complex_type *)a,e3,zero3, e3);
+
+  Sync * sync = psync_pencil_(block);
+  sync->set_stop(nb3_[a_]);
+  if (sync->next()) pencil_solve_(block,j,order);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::pencil_solve_
+(EnzoBlock * block, int j, int order) throw()
+{
+  int k0,k1;
+  pencil_range_(j,&k0,&k1);
+
+  int q3[3] = {K0_,N3_[1],N3_[2]};
+  q3[b_] = k1 - k0;
+
+  std::vector<complex_type> * pencil =
+    buffer_<complex_type>(block,iv_pencil_,q3[0]*q3[1]*q3[2]);
+
+  transform_lines_(pencil->data(),q3,a_,-1);
+
+  int k3[3] = {0,0,0};
+  k3[b_] = k0;
+  divide_eigenvalues_(pencil->data(),k3,q3,order);
+
+  transform_lines_(pencil->data(),q3,a_,+1);
+
+  // Return pencil parts to slab owners
+
+  const int level = block->level();
+
+  int e3[3] = {q3[0],q3[1],q3[2]};
+  e3[a_] = n3_[a_];
+
+  for (int k=0; k<nb3_[a_]; k++) {
+
+    int o3[3] = {0,0,0};
+    o3[a_] = k*n3_[a_];
+
+    std::vector<complex_type> buffer(e3[0]*e3[1]*e3[2]);
+    const int zero3[3] = {0,0,0};
+    copy_box_(buffer.data(),e3,zero3, pencil->data(),q3,o3, e3);
+
+    int is3[3] = {0,0,0};
+    is3[a_] = k;
+
+    enzo::block_array()[index_block_(level,is3[0],is3[1],is3[2])].
+      p_solver_fft_backward (index_,level,j,
+			     2*buffer.size(),(double *)buffer.data());
+  }
+
+  delete_buffer_<complex_type>(block,iv_pencil_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_backward
+(int index_solver, int level, int j, int n, double * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverFft * solver =
+    static_cast<EnzoSolverFft*> (cello::solver(index_solver));
+
+  solver->backward_recv(this,level,j,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::backward_recv
+(EnzoBlock * block, int level, int j, int n, double * a) throw()
+{
+  geometry_(block,level);
+
+  int s3[3] = {N3_[0],N3_[1],N3_[2]};
+  s3[a_] = n3_[a_];
+  const int c3[3] = {K0_,s3[1],s3[2]};
+
+  std::vector<complex_type> * slab =
+    buffer_<complex_type>(block,iv_slab_,c3[0]*c3[1]*c3[2]);
+
+  int k0,k1;
+  pencil_range_(j,&k0,&k1);
+
+  int e3[3] = {c3[0],c3[1],c3[2]};
+  e3[b_] = k1 - k0;
+  int o3[3] = {0,0,0};
+  o3[b_] = k0;
+
+  const int zero3[3] = {0,0,0};
+  copy_box_(slab->data(),c3,o3, (complex_type *)a,e3,zero3, e3);
+
+  Sync * sync = psync_slab_(block);
+  sync->set_stop(nb3_[b_]);
+  if (sync->next()) slab_backward_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::slab_backward_(EnzoBlock * block) throw()
+{
+  int s3[3] = {N3_[0],N3_[1],N3_[2]};
+  if (rank_ >= 2) s3[a_] = n3_[a_];
+  const int c3[3] = {K0_,s3[1],s3[2]};
+
+  std::vector<complex_type> * slab =
+    buffer_<complex_type>(block,iv_slab_,c3[0]*c3[1]*c3[2]);
+
+  if (rank_ == 3) transform_lines_(slab->data(),c3,1,+1);
+
+  std::vector<double> * real =
+    buffer_<double>(block,iv_real_,s3[0]*s3[1]*s3[2]);
+
+  // Complex-to-real transform along x, two rows at a time
+
+  const int num_rows = s3[1]*s3[2];
+  const complex_type * y = slab->data();
+  double * x = real->data();
+  const Fft & fft_x = *fft_[0];
+  cello::parallel_for (0, (num_rows+1)/2, [&](int ip) {
+      const int i0 = 2*ip;
+      const int i1 = 2*ip + 1;
+      const bool pair = (i1 < num_rows);
+      fft_x.backward_real (y + i0*c3[0], pair ? y + i1*c3[0] : nullptr,
+			   x + i0*s3[0], pair ? x + i1*s3[0] : nullptr);
+    });
+
+  delete_buffer_<complex_type>(block,iv_slab_);
+
+  // Scatter X to the Blocks in the slab
+
+  const int level = block->level();
+
+  int ic3[3], nc3[3];
+  block->index_global(&ic3[0],&ic3[1],&ic3[2],&nc3[0],&nc3[1],&nc3[2]);
+
+  int ib3_min[3] = {0,0,0};
+  int ib3_max[3] = {nb3_[0],nb3_[1],nb3_[2]};
+  if (rank_ >= 2) {
+    ib3_min[a_] = ic3[a_];
+    ib3_max[a_] = ic3[a_] + 1;
+  }
+
+  const int n = n3_[0]*n3_[1]*n3_[2];
+  std::vector<double> buffer(n);
+  const int zero3[3] = {0,0,0};
+
+  for (int ibz=ib3_min[2]; ibz<ib3_max[2]; ibz++) {
+    for (int iby=ib3_min[1]; iby<ib3_max[1]; iby++) {
+      for (int ibx=ib3_min[0]; ibx<ib3_max[0]; ibx++) {
+	int o3[3] = {ibx*n3_[0], iby*n3_[1], ibz*n3_[2]};
+	if (rank_ >= 2) o3[a_] = 0;
+	copy_box_(buffer.data(),n3_,zero3, real->data(),s3,o3, n3_);
+	enzo::block_array()[index_block_(level,ibx,iby,ibz)].
+	  p_solver_fft_scatter (index_,n,buffer.data());
+      }
+    }
+  }
+
+  delete_buffer_<double>(block,iv_real_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_scatter
+(int index_solver, int n, double * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverFft * solver =
+    static_cast<EnzoSolverFft*> (cello::solver(index_solver));
+
+  solver->scatter_recv(this,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::scatter_recv
+(EnzoBlock * block, int n, double * a) throw()
+{
+  Field field = block->data()->field();
+
+  int m3[3], g3[3];
+  field.dimensions (ix_,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth(ix_,&g3[0],&g3[1],&g3[2]);
+
+  int n3[3];
+  field.size(&n3[0],&n3[1],&n3[2]);
+
+  ASSERT3 ("EnzoSolverFft::scatter_recv()",
+	   "Solver %s received %d values but expected %d",
+	   name_.c_str(),n,n3[0]*n3[1]*n3[2],
+	   (n == n3[0]*n3[1]*n3[2]));
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+
+  const int zero3[3] = {0,0,0};
+  copy_box_(X,m3,g3, a,n3,zero3, n3);
+
+  Solver::end_(block);
+}
+
+//======================================================================
+
+void EnzoSolverFft::geometry_(Block * block, int level) throw()
+{
+  rank_ = cello::rank();
+
+  Field field = block->data()->field();
+  field.size(&n3_[0],&n3_[1],&n3_[2]);
+
+  Hierarchy * hierarchy = cello::hierarchy();
+  hierarchy->root_blocks(&nb3_[0],&nb3_[1],&nb3_[2]);
+
+  double lower[3], upper[3];
+  hierarchy->lower(&lower[0],&lower[1],&lower[2]);
+  hierarchy->upper(&upper[0],&upper[1],&upper[2]);
+
+  for (int axis=0; axis<3; axis++) {
+    if (axis < rank_) {
+      for (int l=level; l<0; l++) nb3_[axis] = std::max(1,nb3_[axis] >> 1);
+    } else {
+      n3_[axis] = nb3_[axis] = 1;
+    }
+    N3_[axis] = nb3_[axis]*n3_[axis];
+    h3_[axis] = (axis < rank_) ? (upper[axis]-lower[axis]) / N3_[axis] : 1.0;
+  }
+
+  K0_ = N3_[0]/2 + 1;
+  a_ = rank_ - 1;
+  b_ = rank_ - 2;
+
+  for (int axis=0; axis<rank_; axis++) {
+    if (! fft_[axis] || fft_[axis]->size() != N3_[axis]) {
+      fft_[axis] = std::make_shared<Fft>(N3_[axis]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::divide_eigenvalues_
+(complex_type * a, const int k3[3], const int n3[3], int order) const throw()
+{
+  // Stencil coefficients c[0] + c[1]*(shift +-1) + ... and divisor,
+  // matching EnzoMatrixLaplace
+
+  std::vector<double> c;
+  double d = 1.0;
+  if (order == 2) {
+    c = {-2.0, 1.0};
+  } else if (order == 4) {
+    c = {-30.0, 16.0, -1.0};
+    d = 12.0;
+  } else if (order == 6) {
+    c = {-2720.0, 1455.0, -96.0, 1.0};
+    d = 1080.0;
+  } else {
+    ERROR1 ("EnzoSolverFft::divide_eigenvalues_()",
+	    "Unsupported Laplacian order %d",order);
+  }
+
+  // eigenvalues of the 1D operator along each axis
+
+  std::vector<double> lambda[3];
+  for (int axis=0; axis<3; axis++) {
+    lambda[axis].assign(n3[axis],0.0);
+    if (axis >= rank_) continue;
+    const double scale = 1.0 / (d*h3_[axis]*h3_[axis]);
+    for (int i=0; i<n3[axis]; i++) {
+      const double theta = 2.0*cello::pi*(k3[axis]+i) / N3_[axis];
+      double s = c[0];
+      for (size_t m=1; m<c.size(); m++) s += 2.0*c[m]*cos(m*theta);
+      lambda[axis][i] = s*scale;
+    }
+  }
+
+  // divide, including the normalization of the inverse transforms;
+  // eigenvalues are negative except for the (singular) zero mode
+
+  const double norm = 1.0 / (1.0*N3_[0]*N3_[1]*N3_[2]);
+
+  cello::parallel_for_rows
+    (0, n3[2], 0, n3[1], [&](int iz, int iy) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	const int i = ix + n3[0]*(iy + n3[1]*iz);
+	const double l = lambda[0][ix] + lambda[1][iy] + lambda[2][iz];
+	a[i] *= (l < 0.0) ? norm / l : 0.0;
+      }
+    });
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::transform_lines_
+(complex_type * a, const int n3[3], int axis, int sign) const throw()
+{
+  const int n = n3[axis];
+  const int stride = (axis == 0) ? 1 : ((axis == 1) ? n3[0] : n3[0]*n3[1]);
+  const int num_outer = (n3[0]*n3[1]*n3[2]) / (n*stride);
+  const Fft & fft = *fft_[axis];
+
+  cello::parallel_for (0, stride*num_outer, [&](int il) {
+      complex_type * line = a + (il % stride) + (il / stride)*n*stride;
+      std::vector<complex_type> work(n);
+      for (int i=0; i<n; i++) work[i] = line[i*stride];
+      if (sign < 0) fft.forward(work.data());
+      else          fft.backward(work.data());
+      for (int i=0; i<n; i++) line[i*stride] = work[i];
+    });
+}
+
+//----------------------------------------------------------------------
+
+Index EnzoSolverFft::index_block_
+(int level, int i0, int i1, int i2) const throw()
+{
+  // Sub-root Blocks are indexed by the array index of their first
+  // root-level descendent
+
+  const int shift = -level;
+  Index index;
+  index.set_array(i0 << shift, i1 << shift, i2 << shift);
+  index.set_level(level);
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::pencil_range_(int j, int * k0, int * k1) const throw()
+{
+  // along x split the K0_ complex coefficients; otherwise pencils
+  // match the Block decomposition
+  const int n = (b_ == 0) ? K0_ : N3_[b_];
+  const int p = nb3_[b_];
+  (*k0) = (j*n) / p;
+  (*k1) = ((j+1)*n) / p;
+}
@@ -0,0 +1,235 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverFft class
+
+#ifndef ENZO_ENZO_SOLVER_FFT_HPP
+#define ENZO_ENZO_SOLVER_FFT_HPP
+
+class EnzoSolverFft : public Solver {
+
+  /// @class    EnzoSolverFft
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Direct FFT solver for A*X = B with A a
+  /// periodic EnzoMatrixLaplace on a single uniform level
+  ///
+  /// Solves on the Blocks in level max_level_, which must be the root
+  /// level or a sub-root level (so that the level is complete), for
+  /// example as the coarse solver of EnzoSolverMg0 or EnzoSolverDd, or
+  /// standalone on a unigrid mesh.  The level is transformed using a
+  /// slab-to-pencil decomposition, with slabs and pencils held by
+  /// Blocks on the level:
+  ///
+  ///   1. gather:   each Block sends B to the owner of its slab (the
+  ///                Block at the same position along the last axis,
+  ///                and 0 along the others)
+  ///   2. forward:  slab owners transform along all axes but the last,
+  ///                and send the transposed data to pencil owners
+  ///                (split along the second-to-last axis)
+  ///   3. backward: pencil owners transform along the last axis,
+  ///                divide by the eigenvalues of A, inverse transform,
+  ///                and send back to slab owners
+  ///   4. scatter:  slab owners inverse transform and send X back to
+  ///                each Block
+  ///
+  /// In 1D the single slab holds the whole level and steps 2-3 are
+  /// local.  The eigenvalues are those of the discrete Laplacian of
+  /// the given order, so X solves the same linear system as the
+  /// iterative solvers; the (singular) zero mode of X is set to 0.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverFft(std::string name,
+                std::string field_x,
+                std::string field_b,
+                int monitor_iter,
+                int restart_cycle,
+                int solve_type,
+                int index_prolong,
+                int index_restrict,
+                int min_level,
+                int max_level) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverFft);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverFft (CkMigrateMessage *m)
+    : Solver(m),
+      order_(0),
+      is_sync_slab_(-1),
+      is_sync_pencil_(-1),
+      iv_real_(-1),
+      iv_slab_(-1),
+      iv_pencil_(-1),
+      fft_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+
+    p | order_;
+    p | is_sync_slab_;
+    p | is_sync_pencil_;
+    p | iv_real_;
+    p | iv_slab_;
+    p | iv_pencil_;
+    // fft_ is recreated when needed
+  }
+
+public: // virtual methods
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "fft"; }
+
+public: // methods
+
+  /// Receive a Block's right-hand side on its slab owner
+  void gather_recv (EnzoBlock * block, int level, int ic3[3],
+                    int n, double * a) throw();
+
+  /// Receive part of a slab on a pencil owner
+  void forward_recv (EnzoBlock * block, int level, int order, int k,
+                     int n, double * a) throw();
+
+  /// Receive part of a pencil back on its slab owner
+  void backward_recv (EnzoBlock * block, int level, int j,
+                      int n, double * a) throw();
+
+  /// Receive the solution on a Block
+  void scatter_recv (EnzoBlock * block, int n, double * a) throw();
+
+protected: // types
+
+  typedef Fft::complex_type complex_type;
+
+protected: // methods
+
+  /// Initialize the level geometry (block counts, sizes, and
+  /// decomposition axes) and the FFT plans for the given level
+  void geometry_(Block * block, int level) throw();
+
+  /// Transform and send a completed slab to the pencil owners
+  void slab_forward_(EnzoBlock * block) throw();
+
+  /// Transform, solve, and return a completed pencil to the slab owners
+  void pencil_solve_(EnzoBlock * block, int j, int order) throw();
+
+  /// Inverse transform and scatter a completed slab to its Blocks
+  void slab_backward_(EnzoBlock * block) throw();
+
+  /// Divide the transform of B by the eigenvalues of A in the box of
+  /// spectral indices starting at k3 with extents n3
+  void divide_eigenvalues_(complex_type * a, const int k3[3],
+                           const int n3[3], int order) const throw();
+
+  /// Transform all lines of the array a with extents n3 along axis
+  void transform_lines_(complex_type * a, const int n3[3],
+                        int axis, int sign) const throw();
+
+  /// Return the Index of the Block at the given level and position
+  Index index_block_(int level, int i0, int i1, int i2) const throw();
+
+  /// Range [k0,k1) along axis b_ held by pencil j
+  void pencil_range_(int j, int * k0, int * k1) const throw();
+
+  /// Sync counter for slab messages (gather then backward)
+  Sync * psync_slab_(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,is_sync_slab_);
+  }
+
+  /// Sync counter for pencil messages
+  Sync * psync_pencil_(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,is_sync_pencil_);
+  }
+
+  /// Access a Block's buffer (real slab, complex slab, or complex
+  /// pencil), allocating it with the given size if needed
+  template <class T>
+  std::vector<T> * buffer_(Block * block, int iv, int size)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    std::vector<T> ** pbuffer =
+      (std::vector<T> **) scalar_data->value(scalar_descr,iv);
+    if (*pbuffer == nullptr) *pbuffer = new std::vector<T>(size);
+    return *pbuffer;
+  }
+
+  /// Deallocate a Block's buffer
+  template <class T>
+  void delete_buffer_(Block * block, int iv)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    std::vector<T> ** pbuffer =
+      (std::vector<T> **) scalar_data->value(scalar_descr,iv);
+    delete *pbuffer;
+    *pbuffer = nullptr;
+  }
+
+protected: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Order of the Laplacian operator
+  int order_;
+
+  /// Sync Scalar index for counting slab messages
+  int is_sync_slab_;
+
+  /// Sync Scalar index for counting pencil messages
+  int is_sync_pencil_;
+
+  /// void Scalar index for the real slab buffer
+  int iv_real_;
+
+  /// void Scalar index for the complex slab buffer
+  int iv_slab_;
+
+  /// void Scalar index for the complex pencil buffer
+  int iv_pencil_;
+
+  /// FFT plans along each axis for the current level
+  std::shared_ptr<Fft> fft_[3];
+
+  /// Level geometry set by geometry_(): not pup'ed
+
+  /// Rank of the problem
+  int rank_;
+
+  /// Block interior size
+  int n3_[3];
+
+  /// Number of Blocks in the level along each axis
+  int nb3_[3];
+
+  /// Level size along each axis
+  int N3_[3];
+
+  /// Number of complex coefficients along the x-axis (N3_[0]/2+1)
+  int K0_;
+
+  /// Slab axis (last axis) and pencil axis (second-to-last axis)
+  int a_, b_;
+
+  /// Cell widths on the level
+  double h3_[3];
+};
+
+#endif /* ENZO_ENZO_SOLVER_FFT_HPP */
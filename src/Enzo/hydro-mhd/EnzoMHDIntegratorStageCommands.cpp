@@ -21,7 +21,8 @@ EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands
     reconstructors_(),
     integration_quan_updater_(nullptr),
     mhd_choice_(EnzoMHDIntegratorStageCommands::parse_bfield_choice_
-                (args.mhd_choice))
+                (args.mhd_choice)),
+    tile_size_((mhd_choice_ == bfield_choice::no_bfield) ? args.tile_size : 0)
 {
   // check compatability with EnzoPhysicsFluidProps
   EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
@@ -105,6 +106,8 @@ void EnzoMHDIntegratorStageCommands::compute_update_stage
  EnzoEFltArrayMap out_integration_map,
  EnzoEFltArrayMap primitive_map,
  EnzoEFltArrayMap priml_map, EnzoEFltArrayMap primr_map,
+ std::array<EnzoEFltArrayMap, 3> tile_priml_maps,
+ std::array<EnzoEFltArrayMap, 3> tile_primr_maps,
  std::array<EnzoEFltArrayMap, 3> flux_maps_xyz,
  EnzoEFltArrayMap dUcons_map,
  const EnzoEFltArrayMap accel_map,
@@ -144,6 +147,26 @@ void EnzoMHDIntegratorStageCommands::compute_update_stage
 
   // Compute flux along each dimension
   for (int dim = 0; dim < 3; dim++){
+
+    if (tile_size_ > 0) {
+      // the trimmed scratch-array for the interface velocity is sliced into
+      // tiles by compute_flux_tiled_
+      EFlt3DArray sliced_interface_vel_arr;
+      if (fluid_props->dual_energy_config().any_enabled()){
+        sliced_interface_vel_arr = interface_vel_arr.subarray
+          ((dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr),
+           (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr),
+           (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr));
+      }
+      compute_flux_tiled_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
+                          tile_priml_maps[dim], tile_primr_maps[dim],
+                          flux_maps_xyz[dim], dUcons_map,
+                          (fluid_props->dual_energy_config().any_enabled()) ?
+                          &sliced_interface_vel_arr : nullptr,
+                          *reconstructor, stale_depth, passive_list);
+      continue;
+    }
+
     // trim the shape of priml_map and primr_map (they're bigger than
     // necessary so that they can be reused for each dim).
     CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
@@ -262,6 +285,110 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
 
 //----------------------------------------------------------------------
 
+void EnzoMHDIntegratorStageCommands::compute_flux_tiled_
+(const int dim, const double cur_dt, const enzo_float cell_width,
+ EnzoEFltArrayMap &primitive_map,
+ EnzoEFltArrayMap &tile_priml_map, EnzoEFltArrayMap &tile_primr_map,
+ EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+ const EFlt3DArray* const interface_velocity_arr_ptr,
+ EnzoReconstructor &reconstructor,
+ const int stale_depth, const str_vec_t& passive_list) const noexcept
+{
+  const int axis = tile_axis(dim);
+  const int m = primitive_map.array_shape(axis);
+
+  // the reconstructor skips stale_depth rows at either end of its arrays,
+  // while the remaining kernels skip cur_stale_depth rows
+  const int cur_stale_depth = stale_depth + reconstructor.immediate_staling_rate();
+
+  ASSERT("EnzoMHDIntegratorStageCommands::compute_flux_tiled_",
+         "tile_size_ must be at least twice the stale depth",
+         tile_size_ >= 2*cur_stale_depth);
+
+  // returns a map holding rows [start, stop) of map along the tile axis
+  auto rows = [axis](const EnzoEFltArrayMap& map, int start, int stop)
+    {
+      CSlice full(nullptr, nullptr);
+      CSlice slc(start, stop);
+      return (axis == 0) ? map.subarray_map(slc, full, full)
+                         : map.subarray_map(full, slc, full);
+    };
+
+  const bool dual_energy = interface_velocity_arr_ptr != nullptr;
+  const EnzoSourceInternalEnergy eint_src;
+
+  // divide the m rows into tiles of nearly equal size, no larger than
+  // tile_size_ (so each tile has at least tile_size_/2 >= cur_stale_depth
+  // rows)
+  const int num_tiles = (m + tile_size_ - 1) / tile_size_;
+
+  for (int i_tile = 0; i_tile < num_tiles; i_tile++) {
+    const int row_start = (i_tile * m) / num_tiles;
+    const int row_stop  = ((i_tile+1) * m) / num_tiles;
+
+    // rows held by the tile scratch space
+    const int tile_start = std::max(row_start - cur_stale_depth, 0);
+    const int tile_stop  = std::min(row_stop  + cur_stale_depth, m);
+
+    ASSERT("EnzoMHDIntegratorStageCommands::compute_flux_tiled_",
+           "tile scratch-space is too small",
+           tile_stop - tile_start <= tile_priml_map.array_shape(axis));
+
+    // First, reconstruct the left and right interface values over the rows
+    // of the tile padded by stale_depth
+    {
+      const int start = std::max(row_start - stale_depth, 0);
+      const int stop  = std::min(row_stop  + stale_depth, m);
+
+      EnzoEFltArrayMap pl_map = rows(tile_priml_map, start - tile_start,
+                                     stop - tile_start);
+      EnzoEFltArrayMap pr_map = rows(tile_primr_map, start - tile_start,
+                                     stop - tile_start);
+      reconstructor.reconstruct_interface(rows(primitive_map, start, stop),
+                                          pl_map, pr_map, dim, stale_depth,
+                                          passive_list);
+    }
+
+    // Next, compute the fluxes and accumulate the flux divergence over the
+    // rows of the tile padded by cur_stale_depth
+    const EnzoEFltArrayMap pl_map = rows(tile_priml_map, 0,
+                                         tile_stop - tile_start);
+    const EnzoEFltArrayMap pr_map = rows(tile_primr_map, 0,
+                                         tile_stop - tile_start);
+    EnzoEFltArrayMap tile_flux_map = rows(flux_map, tile_start, tile_stop);
+    EnzoEFltArrayMap tile_dUcons_map = rows(dUcons_map, tile_start, tile_stop);
+
+    EFlt3DArray tile_interface_vel_arr;
+    if (dual_energy) {
+      CSlice full(nullptr, nullptr);
+      CSlice slc(tile_start, tile_stop);
+      tile_interface_vel_arr = (axis == 0) ?
+        interface_velocity_arr_ptr->subarray(slc, full, full) :
+        interface_velocity_arr_ptr->subarray(full, slc, full);
+    }
+
+    riemann_solver_->solve(pl_map, pr_map, tile_flux_map, dim,
+                           cur_stale_depth, passive_list,
+                           (dual_energy) ? &tile_interface_vel_arr : nullptr);
+
+    integration_quan_updater_->accumulate_flux_component(dim, cur_dt,
+                                                         cell_width,
+                                                         tile_flux_map,
+                                                         tile_dUcons_map,
+                                                         cur_stale_depth,
+                                                         passive_list);
+
+    if (dual_energy){
+      eint_src.calculate_source(dim, cur_dt, cell_width,
+                                rows(primitive_map, tile_start, tile_stop),
+                                tile_dUcons_map, tile_interface_vel_arr,
+                                cur_stale_depth);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMHDIntegratorStageCommands::compute_source_terms_
 (const double cur_dt, const bool full_timestep,
  const EnzoEFltArrayMap &orig_integration_map,
@@ -29,12 +29,15 @@ struct EnzoMHDIntegratorStageArgPack {
   std::vector<std::string> recon_names;
   double theta_limiter;
   std::string mhd_choice;
+  /// number of rows per tile in the tiled execution mode (0 disables it)
+  int tile_size;
 
   void pup(PUP::er &p) {
     p | rsolver;
     p | recon_names;
     p | theta_limiter;
     p | mhd_choice;
+    p | tile_size;
   }
 };
 
@@ -144,6 +147,22 @@ public:
   bool is_pure_hydro() const noexcept
   { return mhd_choice_ == bfield_choice::no_bfield; }
 
+  /// number of rows per tile when fluxes are computed in the tiled execution
+  /// mode, or 0 if the tiled mode is disabled.
+  ///
+  /// In the tiled mode, reconstruction, the Riemann solve and the flux
+  /// divergence are performed one slab of cells at a time rather than over
+  /// the whole block. The slabs are cut along the z-axis for the x and y
+  /// fluxes and along the y-axis for the z fluxes (see `tile_axis`), so the
+  /// reconstructed primitives only need tile-sized scratch space. The results
+  /// are identical to the untiled mode. This is only supported for pure
+  /// hydrodynamics.
+  int tile_size() const noexcept { return tile_size_; }
+
+  /// the array axis (0, 1, or 2 for z, y, or x) along which the tiles are cut
+  /// when computing fluxes along `dim`
+  static int tile_axis(int dim) noexcept { return (dim == 2) ? 1 : 0; }
+
   /// main workhorse: actually execute a single stage of the MHD integrator.
   ///
   /// Except where otherwise noted, all instances of EnzoEFltArrayMap passed as
@@ -182,7 +201,14 @@ public:
   ///     keys from the "primitive keys" category.
   /// @param[in]     priml_map,primr_map Scratch-space maps that are used to
   ///     hold the left/right reconstructed face-centered primitives. It has
-  ///     keys from the "primitive keys" category (KEY-ORDER MATTERS!!!)
+  ///     keys from the "primitive keys" category (KEY-ORDER MATTERS!!!).
+  ///     These are unused (and may be empty) in the tiled execution mode.
+  /// @param[in]     tile_priml_maps,tile_primr_maps Scratch-space maps used
+  ///     in place of `priml_map` and `primr_map` in the tiled execution mode
+  ///     (they are unused otherwise). Entry `dim` is face-centered along
+  ///     `dim` and holds `tile_size() + 2*stale_depth_max` elements (or
+  ///     fewer, if the block is smaller) along `tile_axis(dim)`, where
+  ///     `stale_depth_max` bounds the stale depth over all stages.
   /// @param[in,out] flux_maps_xyz Array of 3 maps where the calculated fluxes
   ///     for the integration quantities will be stored for the x, y, and z
   ///     directions, respectively. Each map has keys from the
@@ -223,6 +249,8 @@ public:
    EnzoEFltArrayMap primitive_map,
    EnzoEFltArrayMap priml_map,
    EnzoEFltArrayMap primr_map,
+   std::array<EnzoEFltArrayMap, 3> tile_priml_maps,
+   std::array<EnzoEFltArrayMap, 3> tile_primr_maps,
    std::array<EnzoEFltArrayMap, 3> flux_maps_xyz,
    EnzoEFltArrayMap dUcons_map,
    const EnzoEFltArrayMap accel_map,
@@ -326,6 +354,28 @@ protected:
    EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
    const int stale_depth, const str_vec_t& passive_list) const noexcept;
 
+  /// Equivalent to `compute_flux_` (without bfield handling), but the work
+  /// is performed one tile of `tile_size_` rows along `tile_axis(dim)` at a
+  /// time so that the data used by each tile stays in cache.
+  ///
+  /// Each tile is passed to the same kernels used by `compute_flux_` as a
+  /// subarray that is padded by the relevant stale depth along the tile axis.
+  /// Since the kernels skip the stale cells on all sides of their arrays,
+  /// each one computes exactly the tile's rows (since the tile axis differs
+  /// from `dim`, no kernel needs data from neighboring rows).
+  ///
+  /// @param[in]     tile_priml_map,tile_primr_map Tile-sized scratch maps
+  ///     that hold the left/right reconstructed face-centered primitives for
+  ///     one tile at a time.
+  void compute_flux_tiled_
+  (const int dim, const double cur_dt, const enzo_float cell_width,
+   EnzoEFltArrayMap &primitive_map,
+   EnzoEFltArrayMap &tile_priml_map, EnzoEFltArrayMap &tile_primr_map,
+   EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+   const EFlt3DArray* const interface_velocity_arr_ptr,
+   EnzoReconstructor &reconstructor,
+   const int stale_depth, const str_vec_t& passive_list) const noexcept;
+
   /// Computes source terms and accumulate the changes to the integration
   /// quantities in `dUcons_map``dU_cons` accordingly.
   ///
@@ -380,6 +430,9 @@ private:
   /// Indicates how magnetic fields are handled
   bfield_choice mhd_choice_;
 
+  /// Number of rows per tile in the tiled execution mode (0 if disabled)
+  int tile_size_;
+
 };
 
 #endif /* ENZO_MHD_INTEGRATOR_STAGE_COMMANDS_HPP */
@@ -80,7 +80,8 @@ parse_mhdchoice_pack_pair_(ParameterGroup p)
     new EnzoMHDIntegratorStageArgPack {p.value_string("riemann_solver","hlld"),
                                        recon_names,
                                        p.value_float("theta_limiter", 1.5),
-                                       p.value_string("mhd_choice", "")};
+                                       p.value_string("mhd_choice", ""),
+                                       p.value_integer("tile_size", 0)};
 
   return {time_scheme, argpack_ptr};
 }
@@ -132,6 +133,21 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (ParameterGroup p,
   ASSERT1("EnzoMethodMHDVlct::compute", "ghost depth must be at least %d.",
 	  min_gdepth_req, std::min(gx, std::min(gy, gz)) >= min_gdepth_req);
 
+  // Check the tiled execution mode
+  const int tile_size = integrator_arg_pack_->tile_size;
+  if (tile_size > 0 && !integrator_->is_pure_hydro()) {
+    WARNING("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+            "tile_size is ignored when evolving magnetic fields");
+  } else if (tile_size > 0) {
+    // each tile needs at least as many rows as the stale depth
+    ASSERT1("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+            "tile_size must be 0 or at least %d",
+            2*min_gdepth_req, tile_size >= 2*min_gdepth_req);
+  } else {
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "tile_size must not be negative", tile_size == 0);
+  }
+
   // initialize other attributes
   store_fluxes_for_corrections_ = store_fluxes_for_corrections;
   if (store_fluxes_for_corrections){
@@ -199,7 +215,8 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
 //----------------------------------------------------------------------
 
 EnzoEFltArrayMap EnzoMethodMHDVlct::get_integration_map_
-(Block * block,  const str_vec_t *passive_list) const noexcept
+(Block * block,  const str_vec_t *passive_list,
+ std::vector<std::pair<int,enzo_float*>> & converted) const noexcept
 {
   str_vec_t field_list = (passive_list == nullptr) ? integration_field_list_ :
     concat_str_vec_(integration_field_list_, *passive_list);
@@ -208,7 +225,19 @@ EnzoEFltArrayMap EnzoMethodMHDVlct::get_integration_map_
   std::vector<EFlt3DArray> arrays;
   arrays.reserve(field_list.size());
   for (const std::string& field_name : field_list){
-    arrays.push_back( field.view<enzo_float>(field_name) );
+    const int id_field = field.field_id(field_name);
+    if (field.precision(id_field) == default_precision) {
+      arrays.push_back( field.view<enzo_float>(field_name) );
+    } else {
+      // (only passive scalars are allowed at other precisions)
+      int mx,my,mz;
+      field.dimensions(id_field,&mx,&my,&mz);
+      enzo_float * values =
+        Workspace::instance()->allocate<enzo_float>(mx*my*mz);
+      field.values_to(id_field, values);
+      converted.push_back({id_field, values});
+      arrays.push_back( EFlt3DArray(values, mz, my, mx) );
+    }
   }
 
   return EnzoEFltArrayMap("integration",field_list,arrays);
@@ -216,6 +245,20 @@ EnzoEFltArrayMap EnzoMethodMHDVlct::get_integration_map_
 
 //----------------------------------------------------------------------
 
+void EnzoMethodMHDVlct::release_converted_fields_
+(Block * block, std::vector<std::pair<int,enzo_float*>> & converted,
+ bool store) const noexcept
+{
+  Field field = block->data()->field();
+  for (auto & id_values : converted) {
+    if (store) field.values_from(id_values.first, id_values.second);
+    Workspace::instance()->release(id_values.second);
+  }
+  converted.clear();
+}
+
+//----------------------------------------------------------------------
+
 static EnzoEFltArrayMap get_accel_map_(Block* block) noexcept
 {
   Field field = block->data()->field();
@@ -237,10 +280,19 @@ EnzoVlctScratchSpace* EnzoMethodMHDVlct::get_scratch_ptr_
 (const std::array<int,3>& field_shape, const str_vec_t& passive_list) noexcept
 {
   if (scratch_space_ == nullptr){
+    // the stale depth never exceeds the sum of the staling rates of each
+    // stage, which bounds the padding of each tile
+    int tile_padding = 0;
+    const int nstages = static_cast<int>(integrator_arg_pack_->recon_names.size());
+    for (int stage_index = 0; stage_index < nstages; stage_index++) {
+      tile_padding += integrator_->staling_from_stage(stage_index);
+    }
+
     scratch_space_ = new EnzoVlctScratchSpace
       (field_shape, integration_field_list_, primitive_field_list_,
        integrator_->dUcons_map_keys(), passive_list,
-       enzo::fluid_props()->dual_energy_config().any_enabled());
+       enzo::fluid_props()->dual_energy_config().any_enabled(),
+       integrator_->tile_size(), tile_padding);
   }
   return scratch_space_;
 }
@@ -371,8 +423,9 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
     //
     // by the very end of EnzoMethodMHDVlct::compute, the arrays in this map
     // will be updated with their new values
+    std::vector<std::pair<int,enzo_float*>> converted;
     EnzoEFltArrayMap external_integration_map = get_integration_map_
-      (block, &passive_list);
+      (block, &passive_list, converted);
 
     // get maps of arrays and stand-alone arrays that serve as scratch space.
     // (first, retrieve the pointer to the scratch space struct)
@@ -395,6 +448,11 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
     EnzoEFltArrayMap priml_map = scratch->priml_map;
     EnzoEFltArrayMap primr_map = scratch->primr_map;
 
+    // tile-sized counterparts of priml_map and primr_map (along each
+    // dimension) used in the tiled execution mode
+    std::array<EnzoEFltArrayMap, 3> tile_priml_maps = scratch->tile_priml_maps;
+    std::array<EnzoEFltArrayMap, 3> tile_primr_maps = scratch->tile_primr_maps;
+
     // maps used to store fluxes
     std::array<EnzoEFltArrayMap, 3> flux_maps_xyz = {scratch->xflux_map,
                                                      scratch->yflux_map,
@@ -470,7 +528,7 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
          cur_stage_integration_map, // holds values from start of current stage
          out_integration_map,       // where to write results of current stage
          primitive_map, priml_map, primr_map,
-         flux_maps_xyz, dUcons_map, accel_map, interface_vel_arr,
+         tile_priml_maps, tile_primr_maps, flux_maps_xyz, dUcons_map, accel_map, interface_vel_arr,
          passive_list, this->bfield_method_, stage_index,
          cur_dt, stale_depth, cell_widths_xyz);
 
@@ -494,6 +552,8 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
       }
 
     }
+
+    release_converted_fields_(block, converted, true);
   }
 
   block->compute_done();
@@ -548,6 +608,21 @@ void EnzoMethodMHDVlct::post_init_checks_() const noexcept
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodMHDVlct::supports_field_precision
+(const std::string & field_name) const throw()
+{
+  if (std::find(integration_field_list_.begin(), integration_field_list_.end(),
+                field_name) != integration_field_list_.end()) return false;
+  for (const std::string & name : {"pressure", "acceleration_x",
+                                   "acceleration_y", "acceleration_z",
+                                   "bfieldi_x", "bfieldi_y", "bfieldi_z"}) {
+    if (field_name == name) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodMHDVlct::timestep ( Block * block ) throw()
 {
   // analogous to ppm timestep calulation, probably want to require that cfast
@@ -555,8 +630,9 @@ double EnzoMethodMHDVlct::timestep ( Block * block ) throw()
 
   // Constructs a map containing the field data for each integration quantity
   // This includes each passively advected scalar (as densities)
+  std::vector<std::pair<int,enzo_float*>> converted;
   EnzoEFltArrayMap integration_map = get_integration_map_
-    (block, (lazy_passive_list_.get_list()).get());
+    (block, (lazy_passive_list_.get_list()).get(), converted);
 
   EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
 
@@ -582,6 +658,9 @@ double EnzoMethodMHDVlct::timestep ( Block * block ) throw()
   double dtBaryons = integrator_->timestep(integration_map, pressure,
                                            dx, dy, dz);
 
+  // passive scalars are only read
+  release_converted_fields_(block, converted, false);
+
   // Multiply resulting dt by CourantSafetyNumber (for extra safety!).
   // This should be less than 0.5 for standard algorithm
   return dtBaryons * courant_;
@@ -126,6 +126,16 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Integration quantities, pressure and accelerations are accessed as
+  /// enzo_float; passive scalars are converted
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw();
+
+  /// Accelerations are read but not modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return field_name.compare(0, 13, "acceleration_") != 0; }
+
 protected: // methods
 
   /// Completes a handful of sanity-checks that are to be performed after the
@@ -138,9 +148,19 @@ protected: // methods
   /// Constructs a map containing the field data for each integration quantity
   /// This includes all passively advected scalars (as densities) included in
   /// passive_list
-  EnzoEFltArrayMap get_integration_map_(Block * block,
-                                        const str_vec_t *passive_list)
-    const noexcept;
+  ///
+  /// Fields not stored at the default precision are copied to enzo_float
+  /// Workspace arrays, whose field ids and arrays are appended to converted
+  /// and must be passed to release_converted_fields_()
+  EnzoEFltArrayMap get_integration_map_
+  (Block * block, const str_vec_t *passive_list,
+   std::vector<std::pair<int,enzo_float*>> & converted) const noexcept;
+
+  /// Release arrays created by get_integration_map_(), first copying
+  /// them back to their fields if store is true
+  void release_converted_fields_
+  (Block * block, std::vector<std::pair<int,enzo_float*>> & converted,
+   bool store) const noexcept;
 
   /// Saves the fluxes (for a given dimension, `dim`), computed at the faces
   /// between the active and the ghost zones to `block->data()->flux_data()`
@@ -241,12 +261,19 @@ public:
   ///     scalars that should be included in each arraymap.
   /// @param[in] dual_energy Indicates whether the dual energy formalism is in
   ///     use (which specifies if relevant scratch-space should be allocated).
+  /// @param[in] tile_size The number of rows per tile in the tiled execution
+  ///     mode. When this is 0, the tiled mode isn't used and
+  ///     ``tile_priml_maps`` and ``tile_primr_maps`` are left empty.
+  ///     Otherwise, ``priml_map`` and ``primr_map`` are left empty.
+  /// @param[in] tile_padding The maximum stale depth, by which each tile is
+  ///     padded on either side.
   EnzoVlctScratchSpace(const std::array<int,3>& shape,
                        const str_vec_t& integration_key_list,
                        const str_vec_t& primitive_key_list,
                        const str_vec_t& integ_updater_keys,
                        const str_vec_t& passive_list,
-		       bool dual_energy) noexcept
+		       bool dual_energy,
+                       int tile_size = 0, int tile_padding = 0) noexcept
     : interface_vel_arr((dual_energy) ? EFlt3DArray(shape[0],shape[1],shape[2])
 			: EFlt3DArray())
   {
@@ -268,8 +295,27 @@ public:
     zflux_map = setup("zflux", {-1, 0, 0}, integration_key_list);
     dUcons_map = setup("dUcons", {0,0,0}, integ_updater_keys);
     primitive_map = setup("primitive", {0,0,0}, primitive_key_list);
-    priml_map = setup("priml", {0,0,0}, primitive_key_list);
-    primr_map = setup("primr", {0,0,0}, primitive_key_list);
+    if (tile_size == 0) {
+      priml_map = setup("priml", {0,0,0}, primitive_key_list);
+      primr_map = setup("primr", {0,0,0}, primitive_key_list);
+    } else {
+      // the tiles for the fluxes along dim are cut along the z-axis for dim
+      // = 0 or 1 and along the y-axis for dim = 2 (this matches
+      // EnzoMHDIntegratorStageCommands::tile_axis)
+      str_vec_t all_keys(primitive_key_list);
+      all_keys.insert(all_keys.end(), passive_list.begin(), passive_list.end());
+      for (int dim = 0; dim < 3; dim++) {
+        const int axis = (dim == 2) ? 1 : 0;
+        std::array<int,3> tile_shape(shape);
+        tile_shape[2-dim] -= 1;
+        tile_shape[axis] = std::min(tile_shape[axis],
+                                    tile_size + 2*tile_padding);
+        tile_priml_maps[dim] = EnzoEFltArrayMap("tile_priml", all_keys,
+                                                tile_shape);
+        tile_primr_maps[dim] = EnzoEFltArrayMap("tile_primr", all_keys,
+                                                tile_shape);
+      }
+    }
   }
 
 public: // attributes
@@ -299,6 +345,11 @@ public: // attributes
   /// where (mz,my,mx) is the shape of an cell-centered array.
   EnzoEFltArrayMap priml_map, primr_map;
 
+  /// Maps of arrays used in place of priml_map and primr_map in the tiled
+  /// execution mode. Entry ``dim`` is face-centered along ``dim`` and only
+  /// spans a single (padded) tile along the axis that the tiles are cut.
+  std::array<EnzoEFltArrayMap, 3> tile_priml_maps, tile_primr_maps;
+
   /// Maps of arrays that are used to store the x, y, and z fluxes. If a
   /// cell-centered array has shape (mz,my,mx), then these respectively have
   /// shapes of (mz,my,mx-1), (mz,my-1,mx), and (mz-1,my,mx).
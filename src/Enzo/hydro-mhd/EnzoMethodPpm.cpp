@@ -237,6 +237,21 @@ void EnzoMethodPpm::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodPpm::supports_field_precision
+(const std::string & field_name) const throw()
+{
+  for (const std::string & name : {"density", "total_energy",
+                                   "internal_energy", "pressure",
+                                   "velocity_x", "velocity_y", "velocity_z",
+                                   "acceleration_x", "acceleration_y",
+                                   "acceleration_z"}) {
+    if (field_name == name) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodPpm::timestep ( Block * block ) throw()
 {
 
@@ -261,15 +276,25 @@ double EnzoMethodPpm::timestep ( Block * block ) throw()
 
   enzo_float dtBaryons = ENZO_HUGE_VAL;
 
-  /* Compute the pressure. */
-
   enzo_float gamma = enzo::fluid_props()->gamma();
 
+  Field field = enzo_block->data()->field();
+
+  if (enzo_block->is_leaf() && enzo::grackle_method() == nullptr &&
+      ! field.is_field("bfield_x")) {
+
+    // compute the pressure and the timestep in a single sweep
+
+    dtBaryons = timestep_with_pressure_(enzo_block, gamma, cosmo_a);
+
+    return dtBaryons * courant_;
+  }
+
+  /* Compute the pressure. */
+
   EnzoComputePressure compute_pressure(gamma, comoving_coordinates_);
   compute_pressure.compute(enzo_block);
 
-  Field field = enzo_block->data()->field();
-
   int rank = cello::rank();
 
   enzo_float * density    = (enzo_float *)field.values("density");
@@ -313,3 +338,90 @@ double EnzoMethodPpm::timestep ( Block * block ) throw()
 
   return dt;
 }
+
+//----------------------------------------------------------------------
+
+enzo_float EnzoMethodPpm::timestep_with_pressure_
+(EnzoBlock * enzo_block, enzo_float gamma, enzo_float cosmo_a) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  ASSERT("EnzoMethodPpm::timestep_with_pressure_()",
+         "'pressure' must be defined as a permanent field",
+         field.field_id("pressure") >= 0);
+
+  const int rank = cello::rank();
+  const bool dual_energy =
+    ! enzo::fluid_props()->dual_energy_config().is_disabled();
+
+  const enzo_float * d  = (enzo_float *) field.values("density");
+  const enzo_float * te = dual_energy ?
+    NULL : (enzo_float *) field.values("total_energy");
+  const enzo_float * ie = dual_energy ?
+    (enzo_float *) field.values("internal_energy") : NULL;
+  const enzo_float * vx = (enzo_float *) field.values("velocity_x");
+  const enzo_float * vy = (rank >= 2) ?
+    (enzo_float *) field.values("velocity_y") : NULL;
+  const enzo_float * vz = (rank >= 3) ?
+    (enzo_float *) field.values("velocity_z") : NULL;
+  enzo_float * p = (enzo_float *) field.values("pressure");
+
+  const int mx = enzo_block->GridDimension[0];
+  const int my = (rank >= 2) ? enzo_block->GridDimension[1] : 1;
+  const int mz = (rank >= 3) ? enzo_block->GridDimension[2] : 1;
+
+  const int * i1 = enzo_block->GridStartIndex;
+  const int * i2 = enzo_block->GridEndIndex;
+
+  const enzo_float dx = enzo_block->CellWidth[0];
+  const enzo_float dy = enzo_block->CellWidth[1];
+  const enzo_float dz = enzo_block->CellWidth[2];
+
+  const enzo_float gm1 = gamma - 1.0;
+
+  // same bounds as calc_dt.F (tiny and huge in fortran_types.h)
+  const enzo_float tiny = 1e-20;
+  enzo_float dt = 1e20;
+
+  // The pressure is computed for all cells as in EnzoComputePressure,
+  // and the timestep for active cells as in calc_dt.F
+
+  for (int iz=0; iz<mz; iz++) {
+    for (int iy=0; iy<my; iy++) {
+      const bool active_yz =
+        (rank < 2 || (i1[1] <= iy && iy <= i2[1])) &&
+        (rank < 3 || (i1[2] <= iz && iz <= i2[2]));
+      for (int ix=0; ix<mx; ix++) {
+        const int i = ix + mx*(iy + my*iz);
+
+        if (dual_energy) {
+          p[i] = gm1 * d[i] * ie[i];
+        } else {
+          enzo_float ke = 0.5*(vx[i]*vx[i]);
+          if (rank == 2) ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i]);
+          if (rank == 3) ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
+          p[i] = gm1 * (d[i] * (te[i] - ke));
+        }
+
+        if (active_yz && i1[0] <= ix && ix <= i2[0]) {
+          enzo_float cs = std::max(std::sqrt(gamma*p[i]/d[i]), tiny);
+          if (pressure_free_) cs = tiny;
+          enzo_float dt1 = 0.0;
+          if (rank == 1) {
+            dt1 = dx*cosmo_a/(cs + std::abs(vx[i]));
+          } else if (rank == 2) {
+            dt1 = cosmo_a/((cs + std::abs(vx[i]))/dx +
+                           (cs + std::abs(vy[i]))/dy);
+          } else {
+            dt1 = cosmo_a/((cs + std::abs(vx[i]))/dx +
+                           (cs + std::abs(vy[i]))/dy +
+                           (cs + std::abs(vz[i]))/dz);
+          }
+          dt = std::min(dt, dt1);
+        }
+      }
+    }
+  }
+
+  return dt;
+}
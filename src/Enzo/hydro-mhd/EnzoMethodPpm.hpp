@@ -65,9 +65,28 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "ppm"; }
 
+  /// Color fields are advected in enzo_float copies; hydrodynamic
+  /// fields are accessed as enzo_float
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw();
+
+  /// Accelerations are read but not modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return field_name.compare(0, 13, "acceleration_") != 0; }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+protected: // methods
+
+  /// Compute the "pressure" field over the whole Block and return the
+  /// timestep (without the courant factor) in the same sweep; this
+  /// combines EnzoComputePressure and calc_dt, and requires a leaf
+  /// Block without Grackle or magnetic fields
+  enzo_float timestep_with_pressure_
+  (EnzoBlock * enzo_block, enzo_float gamma, enzo_float cosmo_a) throw();
+
 protected: // interface
 
   bool comoving_coordinates_;
@@ -54,11 +54,16 @@ int EnzoMethodPpm::SolveHydroEquations
   field.ghost_depth(0,&gx,&gy,&gz);
   field.dimensions(0,&mx,&my,&mz);
 
+  // temporary arrays are drawn from the per-process Workspace pool,
+  // which reuses them across Blocks of the same size
+
+  Workspace * workspace = Workspace::instance();
+
 #ifdef IE_ERROR_FIELD
   int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
+  int *ie_error_x = workspace->allocate<int>(mx*my*mz);
+  int *ie_error_y = workspace->allocate<int>(mx*my*mz);
+  int *ie_error_z = workspace->allocate<int>(mx*my*mz);
 #else
   int num_ie_error = -1;
   int *ie_error_x = nullptr;
@@ -79,17 +84,35 @@ int EnzoMethodPpm::SolveHydroEquations
   enzo_float * colorpt = (enzo_float *) field.permanent();
 
   // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
-  int index_color = 0;
+  int * coloff   = (ncolor > 0) ? workspace->allocate<int>(ncolor) : NULL;
+  std::vector<int> color_id;
   for (int index_field = 0;
        index_field < field.field_count();
        index_field++) {
     std::string name = field.field_name(index_field);
     if (field.groups()->is_in(name,"color")) {
-      coloff[index_color++]
-	= (enzo_float *)(field.values(index_field)) - colorpt;
+      color_id.push_back(index_field);
     }
+  }
 
+  // color fields stored at a different precision than enzo_float
+  // are advected in an enzo_float copy
+  bool color_convert = false;
+  for (int id : color_id) {
+    if (field.precision(id) != default_precision) color_convert = true;
+  }
+
+  if (color_convert) {
+    colorpt = workspace->allocate<enzo_float>(ncolor*mx*my*mz);
+    for (int index_color=0; index_color<ncolor; index_color++) {
+      coloff[index_color] = index_color*mx*my*mz;
+      field.values_to (color_id[index_color], colorpt + coloff[index_color]);
+    }
+  } else {
+    for (int index_color=0; index_color<ncolor; index_color++) {
+      coloff[index_color] =
+        (enzo_float *)(field.values(color_id[index_color])) - colorpt;
+    }
   }
 
   /* Compute size (in enzo_floats) of the current grid. */
@@ -100,6 +123,17 @@ int EnzoMethodPpm::SolveHydroEquations
   for (dim = 0; dim < rank; dim++)
     size *= block.GridDimension[dim];
 
+  // remaining fields are accessed directly as enzo_float
+  for (std::string name : {"density","total_energy","internal_energy",
+        "velocity_x","velocity_y","velocity_z",
+        "acceleration_x","acceleration_y","acceleration_z"}) {
+    ASSERT1 ("EnzoMethodPpm::SolveHydroEquations()",
+             "Field %s must be stored at the default precision",
+             name.c_str(),
+             (! field.is_field(name) ||
+              field.precision(field.field_id(name)) == default_precision));
+  }
+
   enzo_float * density         = (enzo_float *) field.values("density");
   enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
   enzo_float * internal_energy = (enzo_float *) field.values("internal_energy");
@@ -116,14 +150,14 @@ int EnzoMethodPpm::SolveHydroEquations
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
+    velocity_y = workspace->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
+    velocity_z = workspace->allocate<enzo_float>(size);
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
@@ -200,20 +234,28 @@ int EnzoMethodPpm::SolveHydroEquations
   }
 
   /* allocate temporary space for solver (enough to fit 31 of the largest
-     possible 2d slices plus 4*ncolor). */
+     possible 2d slices plus 4*ncolor), for each thread if the sweeps in
+     ppm_de are threaded with OpenMP. */
 
   int tempsize = MAX(MAX(block.GridDimension[0]*block.GridDimension[1],
 			 block.GridDimension[1]*block.GridDimension[2]),
 		     block.GridDimension[2]*block.GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+#ifdef CONFIG_USE_OPENMP
+  const int num_temp = omp_get_max_threads();
+#else
+  const int num_temp = 1;
+#endif
+
+  enzo_float *temp = workspace->allocate<enzo_float>
+    (num_temp*tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
   size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
 
-  int * array = new int[size];
+  int * array = workspace->allocate<int>(size);
   for (int i=0; i<size; i++) array[i] = 0;
 
   int * p = array;
@@ -254,7 +296,7 @@ int EnzoMethodPpm::SolveHydroEquations
   long long max=std::numeric_limits<long long>::lowest();
 #endif  
  
-  index_color = 0; 
+  int index_color = 0;
   for (int i_f=0; i_f<nf; i_f++) {
     int * flux_index = 0;
     const int index_field = flux_data->index_field(i_f);
@@ -322,7 +364,8 @@ int EnzoMethodPpm::SolveHydroEquations
 
   enzo_float * CellWidthTemp[MAX_DIMENSION];
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [block.GridDimension[dim]];
+    CellWidthTemp[dim] = workspace->allocate<enzo_float>
+      (block.GridDimension[dim]);
     if (dim < rank) {
       for (int i=0; i<block.GridDimension[dim]; i++)
 	CellWidthTemp[dim][i] = (cosmo_a*block.CellWidth[dim]);
@@ -402,22 +445,28 @@ int EnzoMethodPpm::SolveHydroEquations
 #endif
 
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
+    workspace->release(CellWidthTemp[dim]);
   }
 
-  /* deallocate temporary space for solver */
+  /* return temporary space for solver to the workspace */
 
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
+  workspace->release(temp);
+  if (rank < 2) workspace->release(velocity_y);
+  if (rank < 3) workspace->release(velocity_z);
 
-  delete [] array;
+  workspace->release(array);
 
-  delete [] coloff;
+  if (color_convert) {
+    for (int index_color=0; index_color<ncolor; index_color++) {
+      field.values_from (color_id[index_color], colorpt + coloff[index_color]);
+    }
+    workspace->release(colorpt);
+  }
+  workspace->release(coloff);
 #ifdef IE_ERROR_FIELD
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
+  workspace->release(ie_error_x);
+  workspace->release(ie_error_y);
+  workspace->release(ie_error_z);
 #endif
 
   return ENZO_SUCCESS;
@@ -176,7 +176,8 @@ int EnzoMethodPpml::SolveMHDEquations( EnzoBlock& block, enzo_float dt )
     /* allocate temporary space for solver */
 
     int k = 0;
-    enzo_float *temp = new enzo_float[size*(31)];
+    Workspace * workspace = Workspace::instance();
+    enzo_float *temp = workspace->allocate<enzo_float>(size*(31));
     enzo_float *f1 = &temp[k*size];  k++;
     enzo_float *f2 = &temp[k*size];  k++;
     enzo_float *f3 = &temp[k*size];  k++;
@@ -375,7 +376,7 @@ int EnzoMethodPpml::SolveMHDEquations( EnzoBlock& block, enzo_float dt )
 	 qu1,qu2,qu3,qu4,qu5,qu6,qu7);
     /* deallocate temporary space for solver */
 
-    delete [] temp;
+    workspace->release(temp);
 
     delete [] leftface;
 
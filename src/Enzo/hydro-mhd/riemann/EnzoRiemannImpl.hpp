@@ -326,15 +326,16 @@ void EnzoRiemannImpl<KernelFunctor>::solve_
   const int my = config.flux_arr.shape(2);
   const int mx = config.flux_arr.shape(3);
 
-  // compute the flux at all non-stale cell interfaces
-  for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
-    for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+  // compute the flux at all non-stale cell interfaces (rows are split
+  // across threads by cello::parallel_for_rows)
+  cello::parallel_for_rows
+    (stale_depth, mz - stale_depth, stale_depth, my - stale_depth,
+     [&](int iz, int iy) {
       #pragma omp simd
       for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
         kernel(iz,iy,ix);
       }
-    }
-  }
+    });
 }
 
 #endif /* ENZO_ENZO_RIEMANN_IMPL_HPP */
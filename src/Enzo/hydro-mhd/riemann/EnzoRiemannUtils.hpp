@@ -293,8 +293,9 @@ namespace enzo_riemann_utils{
     const int my = density_flux.shape(1);
     const int mx = density_flux.shape(2);
 
-    for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
-      for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+    cello::parallel_for_rows
+      (stale_depth, mz - stale_depth, stale_depth, my - stale_depth,
+       [&](int iz, int iy) {
 
         for (std::size_t key_ind = 0; key_ind < num_keys; key_ind++){
           #pragma omp simd
@@ -307,8 +308,7 @@ namespace enzo_riemann_utils{
           }
         }
 
-      }
-    }
+      });
     delete[] wl_arrays; delete[] wr_arrays; delete[] flux_arrays;
 
   }
@@ -344,6 +344,17 @@ namespace enzo_riemann_utils{
         // given `dim` we could be more precise about the max shape
         internal_energy_flux_ = EFlt3DArray(mz+1,my+1,mx+1);
         velocity_i_bar_array_ = EFlt3DArray(mz+1,my+1,mx+1);
+      } else if ((mz > internal_energy_flux_.shape(0)) |
+                 (my > internal_energy_flux_.shape(1)) |
+                 (mx > internal_energy_flux_.shape(2))) {
+        // in the tiled execution mode of the VL+CT integrator, the shape of
+        // the tiles differs between dimensions, so the scratch space is
+        // grown to cover all of them
+        const int nz = std::max(mz+1, internal_energy_flux_.shape(0));
+        const int ny = std::max(my+1, internal_energy_flux_.shape(1));
+        const int nx = std::max(mx+1, internal_energy_flux_.shape(2));
+        internal_energy_flux_ = EFlt3DArray(nz,ny,nx);
+        velocity_i_bar_array_ = EFlt3DArray(nz,ny,nx);
       }
 
       ASSERT("ScratchArrays_::get_arrays",
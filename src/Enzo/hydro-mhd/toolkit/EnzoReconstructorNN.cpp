@@ -34,14 +34,14 @@ void EnzoReconstructorNN::reconstruct_interface
       const EFlt3DArray wr = primr_map.get(key, stale_depth);
 
       // the following could be optimized
-      for (int iz=0; iz<wc.shape(0)-i_z; iz++) {
-	for (int iy=0; iy<wc.shape(1)-i_y; iy++) {
-	  for (int ix=0; ix<wc.shape(2)-i_x; ix++) {
+      const int nx = wc.shape(2)-i_x;
+      cello::parallel_for_rows
+        (0, wc.shape(0)-i_z, 0, wc.shape(1)-i_y, [&](int iz, int iy) {
+	  for (int ix=0; ix<nx; ix++) {
 	      wl(iz,iy,ix) = wc(iz,iy,ix);
 	      wr(iz,iy,ix) = wc_offset(iz,iy,ix);
 	  }
-	}
-      }
+	});
     };
 
   for (const std::string &key : active_key_names_){ fn(key); }
@@ -204,9 +204,10 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
       // initializing the left (right) interface value thanks to the adoption
       // of immediate_staling_rate
 
-      for (int iz=0; iz<wc_right.shape(0); iz++) {
-        for (int iy=0; iy<wc_right.shape(1); iy++) {
-          for (int ix=0; ix<wc_right.shape(2); ix++) {
+      const int nx = wc_right.shape(2);
+      cello::parallel_for_rows
+        (0, wc_right.shape(0), 0, wc_right.shape(1), [&](int iz, int iy) {
+          for (int ix=0; ix<nx; ix++) {
 
             // compute limited slopes
             enzo_float val = wc_center(iz,iy,ix);
@@ -227,8 +228,7 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
             wr(iz,iy,ix) = right_val;
             wl_offset(iz,iy,ix) = left_val;
           }
-        }
-      }
+        });
     };
 
   for (const std::string &key : active_key_names_){
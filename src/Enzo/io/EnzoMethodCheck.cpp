@@ -10,6 +10,7 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/charm_enzo.hpp"
 #include "Enzo/io/io.hpp"
+#include "Cello/charm_simulation.hpp"
 
 #include <iostream>
 #include <sstream>
@@ -39,7 +40,11 @@ EnzoMethodCheck::EnzoMethodCheck
 (int num_files, std::string ordering,
  std::vector<std::string> directory,
  int monitor_iter,
- bool include_ghosts)
+ bool include_ghosts,
+ int compress_level,
+ bool shuffle,
+ int chunk_size,
+ int max_queued)
   : Method(),
     num_files_(num_files),
     ordering_(ordering),
@@ -60,7 +65,8 @@ EnzoMethodCheck::EnzoMethodCheck
     CkArrayOptions opts(num_files);
     opts.setMap(io_map);
     proxy_io_enzo_writer = CProxy_IoEnzoWriter::ckNew
-      (num_files, ordering,monitor_iter, include_ghosts_, opts);
+      (num_files, ordering,monitor_iter, include_ghosts_,
+       compress_level, shuffle, chunk_size, max_queued, opts);
 
     proxy_io_enzo_writer.doneInserting();
 
@@ -114,12 +120,26 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   
   delete msg;
 
+  if (check_writing_) {
+    // Files from the previous checkpoint are still being written:
+    // start this checkpoint when they are closed in p_check_written()
+    check_enter_pending_ = true;
+  } else {
+    check_enter_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::check_enter_()
+{
   check_num_files_  = enzo::config()->method_check_num_files;
   check_ordering_   = enzo::config()->method_check_ordering;
   check_directory_  = enzo::config()->method_check_dir;
 
   /// Initialize synchronization counters
   sync_check_done_.          set_stop(check_num_files_);
+  sync_check_written_.       set_stop(check_num_files_);
 
   /// Create the directory
 
@@ -134,6 +154,8 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   } else {
     // Else start checkpoint
 
+    check_writing_ = true;
+
     // Create hierarchy file if root writer
 
     std::string name_file = name_dir + "/check.file_list";
@@ -165,12 +187,24 @@ IoEnzoWriter::IoEnzoWriter
 (int num_files,
  std::string ordering,
  int monitor_iter,
- bool include_ghosts) throw ()
+ bool include_ghosts,
+ int compress_level,
+ bool shuffle,
+ int chunk_size,
+ int max_queued) throw ()
   : CBase_IoEnzoWriter(),
     num_files_(num_files),
     ordering_(ordering),
     monitor_iter_(monitor_iter),
-    include_ghosts_(include_ghosts)
+    include_ghosts_(include_ghosts),
+    compress_level_(compress_level),
+    shuffle_(shuffle),
+    chunk_size_(chunk_size),
+    max_queued_(max_queued),
+    write_queue_(),
+    index_next_(),
+    is_next_pending_(false),
+    is_writing_(false)
 {
   TRACE_CHECK("[4] IoEnzoWriter::IoEnzoWriter()");
 }
@@ -227,7 +261,53 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
       ((is_first || is_last) || ((index_block % monitor_iter_) == 0))) {
     cello::monitor()->print("Method", "check %d",index_block);
   }
-  
+
+  // Queue the Block's data, and request the next Block's data while
+  // this one is written, so that the hand-off of Block data overlaps
+  // with file writes
+
+  write_queue_.push_back(msg_check);
+
+  if (!is_last) {
+    index_next_ = index_next;
+    is_next_pending_ = true;
+    request_next_();
+  } else {
+    // All of this file's Blocks have been received: copy any that
+    // still refer to their Block's data, and let the Blocks continue
+    // while the remaining queued Blocks are written
+    for (auto & msg_queued : write_queue_) {
+      if (msg_queued->is_local_) {
+        msg_queued = EnzoMsgCheck::unpack(EnzoMsgCheck::pack(msg_queued));
+      }
+    }
+    proxy_enzo_simulation[0].p_check_done();
+  }
+
+  if (! is_writing_) {
+    is_writing_ = true;
+    thisProxy[thisIndex].p_write_queued();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_queued ()
+{
+  TRACE_CHECK("[A] IoEnzoWriter::p_write_queued");
+
+  EnzoMsgCheck * msg_check = write_queue_.front();
+
+  std::string name_this, name_next;
+  Index index_this, index_next;
+  long long index_block;
+  bool is_first, is_last;
+  std::string name_dir;
+
+  msg_check->get_parameters
+    (index_this,index_next,name_this,name_next,
+     index_block,is_first,is_last,name_dir);
+
   // Write to block list file, opening or closing file as needed
 
   if (is_first) {
@@ -256,6 +336,7 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
   // Write Block to HDF5
   file_write_block_(msg_check);
 
+  write_queue_.pop_front();
   delete msg_check;
 
   if (is_last) {
@@ -263,12 +344,36 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
     close_block_list_();
     // close HDF5 file
     file_->file_close();
+    Performance * performance = cello::simulation()->performance();
+    performance->increment_counter
+      (perf_index_disk_bytes, file_->bytes_written());
+    performance->increment_counter
+      (perf_index_disk_usec, (long long)(1e6*file_->time_write()));
+    proxy_enzo_simulation[0].p_check_written();
   }
 
-  if (!is_last) {
-    enzo::block_array()[index_next].p_check_write_next(num_files_, ordering_);
+  request_next_();
+
+  // continue with the next Block's data if it has already arrived,
+  // otherwise p_write() restarts writing when it does
+
+  if (write_queue_.empty()) {
+    is_writing_ = false;
   } else {
-    proxy_enzo_simulation[0].p_check_done();
+    thisProxy[thisIndex].p_write_queued();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::request_next_ ()
+{
+  // at most max_queued_ Blocks in flight: one being written and the
+  // rest received ahead of it
+
+  if (is_next_pending_ && write_queue_.size() < size_t(max_queued_)) {
+    is_next_pending_ = false;
+    enzo::block_array()[index_next_].p_check_write_next(num_files_, ordering_);
   }
 }
 
@@ -311,6 +416,32 @@ void EnzoSimulation::p_check_done()
 
 //----------------------------------------------------------------------
 
+void EnzoSimulation::p_check_written()
+{
+  TRACE_CHECK("[B] EnzoSimulation::p_check_written()");
+  if (sync_check_written_.next()) {
+    check_writing_ = false;
+    if (check_enter_pending_) {
+      check_enter_pending_ = false;
+      check_enter_();
+    } else if (check_exit_count_ >= 0) {
+      const int count = check_exit_count_;
+      check_exit_count_ = -1;
+      proxy_main.p_exit(count);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_defer_exit(int count)
+{
+  if (check_writing_) check_exit_count_ = count;
+  return check_writing_;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoBlock::p_check_done()
 {
   TRACE_CHECK_BLOCK("[C] EnzoBlock::p_check_done()",this);
@@ -412,6 +543,9 @@ FileHdf5 * IoEnzoWriter::file_open_
 {
   // Create File
   FileHdf5 * file = new FileHdf5 (path_name, file_name);
+  file->set_compress(compress_level_);
+  file->set_shuffle(shuffle_);
+  file->set_chunk_size(chunk_size_);
   file->file_create();
 
   return file;
@@ -502,69 +636,173 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
   file_->group_write_meta
     (msg_check->adapt_buffer_,"adapt_buffer",type_int,ADAPT_BUFFER_SIZE);
 
-  // Create new data object to hold EnzoMsgCheck/DataMsg fields and particles
+  // Write fields and particles directly from the message where
+  // possible.  Local messages refer to the sending Block's data, which
+  // is not modified until the file's last Block is received (see
+  // p_write()); remote messages hold fields packed without ghost zones
+
+  DataMsg * data_msg = msg_check->data_msg_;
+
+  bool is_written = false;
+  if (data_msg == nullptr) {
+    is_written = true;
+  } else if (msg_check->is_local_) {
+    if (data_msg->field_face() != nullptr)
+      write_field_data_(data_msg->field_data());
+    if (data_msg->particle_data() != nullptr)
+      write_particles_
+        (Particle(cello::particle_descr(),data_msg->particle_data()));
+    is_written = true;
+  } else if (! include_ghosts_) {
+    if ((data_msg->field_face() == nullptr) ||
+        write_field_array_(data_msg,size)) {
+      if (data_msg->particle_data() != nullptr)
+        write_particles_
+          (Particle(cello::particle_descr(),data_msg->particle_data()));
+      is_written = true;
+    }
+  }
 
-  Data * data;
-  bool data_allocated (true);
+  if (! is_written) {
 
-  int num_field_data=1;
-  data = new Data
-    (size[0],size[1],size[2],
-     num_field_data,
-     lower[0],lower[1],lower[2],
-     upper[0],upper[1],upper[2],
-     cello::field_descr(),
-     cello::particle_descr());
+    // Otherwise create new data object to hold EnzoMsgCheck/DataMsg
+    // fields and particles
 
-  data->allocate();
+    int num_field_data=1;
+    Data * data = new Data
+      (size[0],size[1],size[2],
+       num_field_data,
+       lower[0],lower[1],lower[2],
+       upper[0],upper[1],upper[2],
+       cello::field_descr(),
+       cello::particle_descr());
 
-  msg_check->update(data);
+    data->allocate();
 
-  // Write Block Field data
+    msg_check->update(data);
 
-  // number of "history" field data objects
-  const int nh = data->num_field_data();
+    write_field_data_(data->field_data());
+    write_particles_(data->particle());
+
+    delete data;
+  }
+
+  file_->group_close();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::write_field_data_ (FieldData * field_data)
+{
   const int nf = cello::field_descr()->field_count();
-  // // May have multiple field_data objects for field history
-  if (nh > 0) {
-    for (int i_h=0; i_h<nh; i_h++) {
-      FieldData * field_data = data->field_data(i_h);
-      for (int i_f=0; i_f<nf; i_f++) {
-        const int index_field = i_f;
-;
-        IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
-        io_field_data -> set_include_ghosts (include_ghosts_);
-
-        void * buffer;
-        std::string name;
-        int type;
-        int mx,my,mz;  // Array dimension
-        int nx,ny,nz;  // Array size
-
-        io_field_data->set_field_data((FieldData*)field_data);
-        io_field_data->set_field_index(index_field);
-        io_field_data->field_array
-          (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
-
-        file_->mem_create(mx,my,mz,nx,ny,nz,0,0,0);
-        if (mz > 1) {
-          file_->data_create(name.c_str(),type,nz,ny,nx,1,nz,ny,nx,1);
-        } else if (my > 1) {
-          file_->data_create(name.c_str(),type,ny,nx,  1,1,ny,nx, 1,1);
-        } else {
-          file_->data_create(name.c_str(),type,nx,  1,  1,1,nx,  1,1,1);
-        }
-        file_->data_write(buffer);
-        file_->data_close();
+  for (int i_f=0; i_f<nf; i_f++) {
+    const int index_field = i_f;
 
-        delete io_field_data;
-      }
+    IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
+    io_field_data -> set_include_ghosts (include_ghosts_);
+
+    void * buffer;
+    std::string name;
+    int type;
+    int mx,my,mz;  // Array dimension
+    int nx,ny,nz;  // Array size
+
+    io_field_data->set_field_data(field_data);
+    io_field_data->set_field_index(index_field);
+    io_field_data->field_array
+      (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
+
+    file_->mem_create(mx,my,mz,nx,ny,nz,0,0,0);
+    if (mz > 1) {
+      file_->data_create(name.c_str(),type,nz,ny,nx,1,nz,ny,nx,1);
+    } else if (my > 1) {
+      file_->data_create(name.c_str(),type,ny,nx,  1,1,ny,nx, 1,1);
+    } else {
+      file_->data_create(name.c_str(),type,nx,  1,  1,1,nx,  1,1,1);
     }
+    file_->data_write(buffer);
+    file_->data_close();
+
+    delete io_field_data;
   }
-  // // Write Block Particle data
+}
 
-  Particle particle = data->particle();
+//----------------------------------------------------------------------
 
+bool IoEnzoWriter::write_field_array_
+(DataMsg * data_msg, const int size[3])
+{
+  FieldDescr * field_descr = cello::field_descr();
+  FieldFace * field_face = data_msg->field_face();
+
+  // unallocated FieldData: only used for the Block size
+  FieldData field_data (field_descr,size[0],size[1],size[2]);
+  Field field (field_descr,&field_data);
+
+  auto field_list = field_face->refresh()->field_list_src();
+  const int nf = field_list.size();
+
+  // check that the packed fields are the Block interiors written by
+  // IoFieldData, in field index order
+
+  if (nf != field_descr->field_count()) return false;
+  for (int i_f=0; i_f<nf; i_f++) {
+    const int index_field = field_list[i_f];
+    int n3[3],c3[3];
+    field_face->array_size(field,i_f,n3);
+    field_descr->centering(index_field,c3,c3+1,c3+2);
+    if ((index_field != i_f) ||
+        (n3[0] != size[0] + c3[0]) ||
+        (n3[1] != size[1] + c3[1]) ||
+        (n3[2] != size[2] + c3[2])) return false;
+  }
+
+  char * array = data_msg->field_array();
+
+  for (int i_f=0; i_f<nf; i_f++) {
+    const int index_field = field_list[i_f];
+
+    int n3[3];
+    field_face->array_size(field,i_f,n3);
+    const int nx = n3[0];
+    const int ny = n3[1];
+    const int nz = n3[2];
+
+    precision_type precision = field_descr->precision(index_field);
+    if (precision == precision_default) precision = default_precision;
+    int type = type_unknown;
+    switch (precision) {
+    case precision_single:    type = type_float;     break;
+    case precision_double:    type = type_double;    break;
+    case precision_quadruple: type = type_quadruple; break;
+    default:
+      ERROR2 ("IoEnzoWriter::write_field_array_()",
+              "Unsupported precision type %d for field %s",
+              precision, field_descr->field_name(index_field).c_str());
+    }
+
+    const std::string name = "field_" + field_descr->field_name(index_field);
+
+    file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+    if (nz > 1) {
+      file_->data_create(name.c_str(),type,nz,ny,nx,1,nz,ny,nx,1);
+    } else if (ny > 1) {
+      file_->data_create(name.c_str(),type,ny,nx,  1,1,ny,nx, 1,1);
+    } else {
+      file_->data_create(name.c_str(),type,nx,  1,  1,1,nx,  1,1,1);
+    }
+    file_->data_write(array);
+    file_->data_close();
+
+    array += nx*ny*nz*cello::sizeof_precision(precision);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::write_particles_ (Particle particle)
+{
   for (int it=0; it<particle.num_types(); it++) {
 
     // get the number of particle batches and attributes
@@ -574,9 +812,6 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
     // For each particle attribute
     for (int ia=0; ia<na; ia++) {
 
-      IoParticleData * io_particle_data =
-        enzo::factory()->create_io_particle_data();
-
       // For each particle attribute
       int np = particle.num_particles (it);
 
@@ -626,13 +861,8 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
 
       // close the attribute dataset
       file_->data_close();
-      delete io_particle_data;
     }
   }
-
-  if (data_allocated) delete data;
-
-  file_->group_close();
 }
 
 //----------------------------------------------------------------------
@@ -21,7 +21,11 @@ public: // interface
   (int num_files, std::string ordering,
    std::vector<std::string> directory,
    int monitor_iter,
-   bool include_ghosts);
+   bool include_ghosts,
+   int compress_level,
+   bool shuffle,
+   int chunk_size,
+   int max_queued);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodCheck);
@@ -42,6 +46,21 @@ public: // virtual methods
   virtual std::string name () throw ()
   { return "check"; }
 
+  /// Fields are written at their own precision
+  virtual bool supports_field_precision (const std::string & field_name)
+    const throw()
+  { return true; }
+
+  /// Does not modify fields
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
+  /// Contributes to reductions over all Blocks, so is only applied when
+  /// all levels are synchronized when subcycling
+  virtual bool is_synchronized () const throw()
+  { return true; }
+
 protected: // methods
 
   DataMsg * create_data_msg_ (Block * block);
@@ -33,7 +33,12 @@ public: // interface
     //    p | stream_block_list_;
     //    p | file_;
     p | sync_blocks_;
-    //    p | io_msg_check_;
+    p | block_name_list_;
+    p | level_blocks_;
+    //    p | msg_check_queue_;
+    p | index_read_;
+    p | num_pending_;
+    p | max_read_ahead_;
   }
 
   /// Send data to existing root blocks
@@ -59,8 +64,17 @@ protected: // functions
   void block_ready_();
   void block_created_();
 
+  /// Begin reading Blocks of the current level
+  void stream_start_();
+  /// Read Blocks of the current level up to the read-ahead limit
+  void read_ahead_();
+  /// Send Blocks read to the Block array, then read ahead
+  void stream_blocks_();
+
   void file_open_block_list_(std::string name_dir, std::string name_file);
   void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name);
+  /// Read only the Block's attributes, e.g. its index and order
+  void file_read_block_meta_(IoEnzoBlock * io_block, std::string block_name);
   void file_read_block_fields_(DataMsg * data_msg, int nx, int ny, int nz);
   void file_read_block_particles_(DataMsg * data_msg);
   bool read_block_list_(std::string & block_name, int & level);
@@ -92,20 +106,28 @@ private: // attributes
 
   Sync sync_blocks_;
 
-  /// List of blocks in the file by level (negative blocks included in
-  /// level 0
-  std::vector< std::vector<EnzoMsgCheck *> > io_msg_check_;
 
   /// Current level
   int level_;
   /// List of block names in the file
   std::vector<std::string> block_name_list_;
 
-  /// List of levels for the in block_name_list_
-  std::vector<int>         block_level_list_;
 
-  /// Count of blocks in each level_
-  std::vector<int> blocks_in_level_;
+  /// Indices into block_name_list_ of blocks in each level (negative
+  /// level blocks included in level 0)
+  std::vector< std::vector<int> > level_blocks_;
+
+  /// Blocks in the current level read but not yet sent
+  std::deque<EnzoMsgCheck *> msg_check_queue_;
+
+  /// Position in level_blocks_[level_] of the next Block to read
+  int index_read_;
+
+  /// Number of Blocks sent but not yet acknowledged
+  int num_pending_;
+
+  /// Maximum number of Blocks read ahead and of Blocks in flight
+  int max_read_ahead_;
 };
 
 #endif /* ENZO_IO_ENZO_READER_HPP */
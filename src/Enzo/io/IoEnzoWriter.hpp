@@ -23,14 +23,26 @@ public: // interface
     stream_block_list_(),
     file_(nullptr),
     monitor_iter_(0),
-    include_ghosts_(false)
+    include_ghosts_(false),
+    compress_level_(0),
+    shuffle_(true),
+    chunk_size_(0),
+    max_queued_(2),
+    write_queue_(),
+    index_next_(),
+    is_next_pending_(false),
+    is_writing_(false)
   {  }
 
   /// Constructor
   IoEnzoWriter(int num_files,
                std::string ordering,
                int monitor_iter,
-               bool include_ghosts) throw();
+               bool include_ghosts,
+               int compress_level,
+               bool shuffle,
+               int chunk_size,
+               int max_queued) throw();
 
   /// CHARM++ migration constructor
   IoEnzoWriter(CkMigrateMessage *m) : CBase_IoEnzoWriter(m) {}
@@ -44,12 +56,20 @@ public: // interface
     p | ordering_;
     p | monitor_iter_;
     p | include_ghosts_;
+    p | compress_level_;
+    p | shuffle_;
+    p | chunk_size_;
+    p | max_queued_;
   }
 
 public: // entry methods
 
+  /// Receive a Block's data and queue it for writing
   void p_write(EnzoMsgCheck *);
 
+  /// Write the oldest queued Block, continuing until the queue is empty
+  void p_write_queued();
+
   // void r_created(CkReductionMsg *msg);
 
 protected: // functions
@@ -58,6 +78,21 @@ protected: // functions
   std::ofstream create_block_list_(std::string name_dir, std::string name_file);
   void file_write_hierarchy_();
   void file_write_block_(EnzoMsgCheck * msg_check);
+
+  /// Write a Block's fields directly from a FieldData object
+  void write_field_data_(FieldData * field_data);
+
+  /// Write a Block's fields directly from the packed array of a
+  /// DataMsg received from another process; returns false without
+  /// writing if the packed layout does not match the file layout
+  bool write_field_array_(DataMsg * data_msg, const int size[3]);
+
+  /// Write a Block's particles
+  void write_particles_(Particle particle);
+
+  /// Request the next Block's data if one is pending and the write
+  /// queue has room
+  void request_next_();
   void write_meta_ ( FileHdf5 * file, Io * io, std::string type_meta );
 
   void write_block_list_(std::string block_name, int level);
@@ -83,6 +118,31 @@ protected: // attributes
 
   /// Whether to include ghost zones
   bool include_ghosts_;
+
+  /// HDF5 deflate compression level, 0 for none
+  int compress_level_;
+
+  /// Whether to shuffle bytes before compressing
+  bool shuffle_;
+
+  /// Maximum HDF5 chunk extent along each axis, 0 for whole datasets
+  int chunk_size_;
+
+  /// Maximum number of Blocks whose data is held by the writer
+  int max_queued_;
+
+  /// Block data received but not yet written (not pup'ed: empty
+  /// between checkpoints)
+  std::deque<EnzoMsgCheck *> write_queue_;
+
+  /// Index of the next Block to request data from
+  Index index_next_;
+
+  /// Whether the next Block's data is waiting for room in the queue
+  bool is_next_pending_;
+
+  /// Whether p_write_queued() is scheduled or running
+  bool is_writing_;
 };
 
 #endif /* ENZO_IO_ENZO_WRITER_HPP */
@@ -156,11 +156,13 @@ IoEnzoReader::IoEnzoReader()
     stream_block_list_(),
     file_(nullptr),
     sync_blocks_(),
-    io_msg_check_(),
     level_(0),
     block_name_list_(),
-    block_level_list_(),
-    blocks_in_level_()
+    level_blocks_(),
+    msg_check_queue_(),
+    index_read_(0),
+    num_pending_(0),
+    max_read_ahead_(1)
 {
   proxy_enzo_simulation[0].p_io_reader_created();
 }
@@ -220,102 +222,40 @@ void IoEnzoReader::p_init_root
   name_dir_  = name_dir;
   name_file_ = name_file;
   max_level_ = max_level;
+  max_read_ahead_ = std::max(1,cello::config()->initial_restart_read_ahead);
 
   stream_block_list_ = stream_open_blocks_(name_dir, name_file);
 
   // open the HDF5 file
   file_open_block_list_(name_dir,name_file);
 
-  sync_blocks_.reset();
-  TRACE_SYNC(sync_blocks_,"sync_blocks_ reset()");
-
   // Read global attributes
   file_read_hierarchy_();
 
-  blocks_in_level_.resize(max_level+1);
-
+  // Read list of blocks and associated refinement levels. Only the
+  // names are kept: Block data are read from the file as they are
+  // sent, keeping at most max_read_ahead_ Blocks in memory
+  level_blocks_.resize(max_level+1);
   std::string block_name;
   int block_level;
-  // Read list of blocks and associated refinement levels
   while (read_block_list_(block_name,block_level)) {
-
-    // save block name and level
+    // negative level blocks are initialized with the root level
+    level_blocks_[std::max(block_level,0)].push_back
+      (block_name_list_.size());
     block_name_list_.push_back(block_name);
-    block_level_list_.push_back(block_level);
-
-    if (block_level <= 0) {
-      // count root-level blocks for synchronization
-      // (including negative level blocks)
-      ++ sync_blocks_;
-      TRACE_SYNC(sync_blocks_,"sync_blocks_ inc_stop(1)");
-    } else {
-      // count blocks per refined level for array allocation below
-      ++blocks_in_level_[block_level];
-    }
-  }
-
-  // Allocate io_msg_check_ array
-  io_msg_check_.resize(max_level+1);
-  for (int level=1; level<=max_level; level++) {
-    io_msg_check_[level].resize(blocks_in_level_[level]);
   }
 
-  // initialize vector of array offsets into io_msg_check_ for each level
-  std::vector<int> level_index;
-  level_index.resize(max_level+1);
-  std::fill(level_index.begin(), level_index.end(), 0);
-
-  // Save block's meta-data and initialize root-level blocks
-  for (int i=0; i<block_name_list_.size(); i++) {
-
-    // Increment block counter so know when to alert pe=0 when done
-    const int block_level = block_level_list_[i];
-    std::string block_name = block_name_list_[i];
-    int i_level = level_index[std::max(block_level,0)]++;
-
-    // For each Block in the file, read the block data and create the
-    // new Block
-
-    EnzoMsgCheck * msg_check = new EnzoMsgCheck;
-
-    // Save msg_check for later if block is in a refined level
-    if (block_level > 0) {
-      io_msg_check_[block_level][i_level] = msg_check;
-    }
-
-    // create new IoEnzoBlock object for root blocks, use io_msg_check_
-    // element for refined blocks
-    IoEnzoBlock * io_enzo_block = new IoEnzoBlock;
-
-    msg_check->set_io_block(io_enzo_block);
-    if (block_level <= 0) {
-      file_read_block_ (msg_check, block_name);
-    }
-
-    // save this file IoReader index
-    msg_check->index_file_ = thisIndex;
-
-    // get Block's index
-    int v3[3];
-    msg_check->io_block_->index(v3);
-    Index index;
-    index.set_values(v3);
-
-    // if non-refined block, initialize
-    if (block_level <= 0) {
-
-      // Block exists--send its data
-#ifdef DEBUG_RESTART
-      msg_check->print("send");
-      msg_check->data_msg_->print("send");
-#endif
-      enzo::block_array()[index].p_restart_set_data(msg_check);
+  // Root-level Blocks already exist--stream their data
+  level_ = 0;
+  sync_blocks_.reset();
+  TRACE_SYNC(sync_blocks_,"sync_blocks_ reset()");
+  sync_blocks_.set_stop(level_blocks_[0].size() + 1);
+  TRACE_SYNC(sync_blocks_,"sync_blocks_ set_stop()");
 
-    }
-  }
+  stream_start_();
+  stream_blocks_();
 
-  // self + 1
-  ++ sync_blocks_;
+  // self
   block_ready_();
 }
 
@@ -345,7 +285,12 @@ void EnzoBlock::restart_set_data_(EnzoMsgCheck * msg_check)
 //----------------------------------------------------------------------
 
 void IoEnzoReader::p_block_ready()
-{ block_ready_(); }
+{
+  // a Block has its data: send the next Block read and read another
+  --num_pending_;
+  stream_blocks_();
+  block_ready_();
+}
 
 void IoEnzoReader::block_ready_()
 {
@@ -354,6 +299,9 @@ void IoEnzoReader::block_ready_()
   // Wait for all of the reader's blocks in the current level to be
   // ready
   if (sync_blocks_.next()) {
+    if (level_ == max_level_) {
+      file_close_block_list_();
+    }
     proxy_enzo_simulation[0].p_restart_next_level();
   }
 }
@@ -384,38 +332,37 @@ void IoEnzoReader::p_create_level (int level)
 {
   level_ = level;
   TRACE_READER("p_create_level()",this);
-  const int num_blocks_level = io_msg_check_[level].size();
+  const std::vector<int> & blocks = level_blocks_[level];
   sync_blocks_.reset();
-  sync_blocks_.set_stop(num_blocks_level+1);
-  int i=0;
-  for (int k=0; k<block_name_list_.size(); k++) {
-    // skip over blocks not in current level
-    if (block_level_list_[k] != level) continue;
+  sync_blocks_.set_stop(blocks.size()+1);
+  for (size_t i=0; i<blocks.size(); i++) {
 
-    EnzoMsgCheck * msg_check = io_msg_check_[level][i];
-    IoEnzoBlock * io_enzo_block = new IoEnzoBlock;
-    msg_check->set_io_block (io_enzo_block);
+    // Only the Block's attributes are needed to create it
 
-    std::string block_name = block_name_list_[k];
-    file_read_block_ (msg_check, block_name);
+    IoEnzoBlock io_block;
+    file_read_block_meta_ (&io_block, block_name_list_[blocks[i]]);
 
-    IoEnzoBlock * io_block = io_msg_check_[level][i]->io_block();
     int i3[3];
-    io_block->index(i3);
+    io_block.index(i3);
     Index index;
     index.set_values(i3);
     Index index_parent = index.index_parent();
     int ic3[3];
     index.child(level,ic3,ic3+1,ic3+2);
 
+    // Create the Block directly on the process given by its saved
+    // position in the space-filling curve ordering
     long long index_order,count_order;
-    io_block->get_order(&index_order,&count_order);
+    io_block.get_order(&index_order,&count_order);
     int ip = (long long) CkNumPes()*index_order / count_order;
 
     enzo::block_array()[index_parent].p_restart_refine(ic3,thisIndex,ip);
-
-    i++;
   }
+
+  // Start reading the level's Block data while Blocks are created
+  stream_start_();
+  read_ahead_();
+
   // self
   block_created_();
 }
@@ -513,37 +460,79 @@ void EnzoSimulation::p_restart_level_created()
 void IoEnzoReader::p_init_level (int level)
 {
   TRACE_READER("p_init_level()",this);
-  const int num_blocks_level = io_msg_check_[level].size();
+  level_ = level;
   TRACE_SYNC(sync_blocks_,"sync_blocks_ reset()");
   sync_blocks_.reset();
   TRACE_SYNC(sync_blocks_,"sync_blocks_ set_stop()");
-  sync_blocks_.set_stop(num_blocks_level+1);
-  // Loop through blocks in the given level
-  int i=0;
-  for (int k=0; k<block_name_list_.size(); k++) {
-    if (block_level_list_[k] != level) continue;
-    EnzoMsgCheck * msg_check = io_msg_check_[level][i];
-
-    // Get the current Block's index
-    IoBlock * io_block = msg_check->io_block();
+  sync_blocks_.set_stop(level_blocks_[level].size()+1);
+
+  // Send data to the level's Blocks as they are read
+  stream_blocks_();
+
+  // self
+  block_ready_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::stream_start_()
+{
+  ASSERT2 ("IoEnzoReader::stream_start_()",
+           "%d Blocks read and %d sent but not yet initialized",
+           msg_check_queue_.size(),num_pending_,
+           msg_check_queue_.empty() && num_pending_ == 0);
+  index_read_ = 0;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::read_ahead_()
+{
+  const std::vector<int> & blocks = level_blocks_[level_];
+  while (index_read_ < int(blocks.size()) &&
+         int(msg_check_queue_.size()) < max_read_ahead_) {
+
+    const int k = blocks[index_read_++];
+
+    EnzoMsgCheck * msg_check = new EnzoMsgCheck;
+    msg_check->set_io_block(new IoEnzoBlock);
+    file_read_block_ (msg_check, block_name_list_[k]);
+
+    // save this file IoReader index
+    msg_check->index_file_ = thisIndex;
+
+    msg_check_queue_.push_back(msg_check);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::stream_blocks_()
+{
+  read_ahead_();
+
+  // Send Blocks already read, limiting the number in flight
+  while (! msg_check_queue_.empty() && num_pending_ < max_read_ahead_) {
+
+    EnzoMsgCheck * msg_check = msg_check_queue_.front();
+    msg_check_queue_.pop_front();
+
+    // Get the Block's index
     int i3[3];
-    io_block->index(i3);
+    msg_check->io_block()->index(i3);
     Index index;
     index.set_values(i3);
 
-    msg_check->index_file_ = thisIndex;
 #ifdef DEBUG_RESTART
     msg_check->print("send");
     msg_check->data_msg_->print("send");
 #endif
     enzo::block_array()[index].p_restart_set_data(msg_check);
-    i++;
+    ++num_pending_;
   }
-  // self + 1
-    if (level == max_level_) {
-      file_close_block_list_();
-    }
-  block_ready_();
+
+  // Read the next Blocks while the ones sent are initialized
+  read_ahead_();
 }
 
 //----------------------------------------------------------------------
@@ -622,6 +611,18 @@ void IoEnzoReader::file_read_hierarchy_()
 
 //----------------------------------------------------------------------
 
+void IoEnzoReader::file_read_block_meta_
+(IoEnzoBlock * io_block, std::string name_block)
+{
+  std::string group_name = "/" + name_block;
+  file_->group_chdir(group_name);
+  file_->group_open();
+  read_meta_(file_, io_block, "group");
+  file_->group_close();
+}
+
+//----------------------------------------------------------------------
+
 void IoEnzoReader::file_read_block_
 (EnzoMsgCheck * msg_check,
  std::string    name_block)
@@ -13,6 +13,7 @@
 //----------------------------------------------------------------------
 
 #include <string>
+#include <deque>
 #include <vector>
 
 //----------------------------------------------------------------------
@@ -68,8 +68,14 @@ void EnzoProlong::apply
     // only call EnzoProlong if accumulate = false
     if (!use_linear_) {
       // only call EnzoProlong if not reverting to linear
-      apply_((enzo_float *)     values_f,m3_f,o3_f,n3_f,
-             (const enzo_float*)values_c,m3_c,o3_c,n3_c,accumulate);
+      if (precision == default_precision) {
+        apply_((enzo_float *)     values_f,m3_f,o3_f,n3_f,
+               (const enzo_float*)values_c,m3_c,o3_c,n3_c,accumulate);
+      } else {
+        apply_convert_(precision,
+                       values_f,m3_f,o3_f,n3_f,
+                       values_c,m3_c,o3_c,n3_c);
+      }
     }  else {
       static bool first_call = true;
       if (first_call) {
@@ -107,6 +113,70 @@ void EnzoProlong::apply
   }
 
 }
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Copy n values between arrays of the given precision and T
+  template <class T>
+  void copy_to_ (T * dst, const void * src, precision_type precision, int n)
+  {
+    if (precision == precision_single) {
+      std::copy_n ((const float *)src, n, dst);
+    } else if (precision == precision_double) {
+      std::copy_n ((const double *)src, n, dst);
+    } else if (precision == precision_quadruple) {
+      std::copy_n ((const long double *)src, n, dst);
+    } else {
+      ERROR1 ("EnzoProlong::apply()", "Unsupported precision %d", precision);
+    }
+  }
+
+  template <class T>
+  void copy_from_ (void * dst, const T * src, precision_type precision, int n)
+  {
+    if (precision == precision_single) {
+      std::copy_n (src, n, (float *)dst);
+    } else if (precision == precision_double) {
+      std::copy_n (src, n, (double *)dst);
+    } else if (precision == precision_quadruple) {
+      std::copy_n (src, n, (long double *)dst);
+    } else {
+      ERROR1 ("EnzoProlong::apply()", "Unsupported precision %d", precision);
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoProlong::apply_convert_
+( precision_type precision,
+  void *       values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+  const void * values_c, int m3_c[3], int o3_c[3], int n3_c[3])
+{
+  const int mc = m3_c[0]*m3_c[1]*m3_c[2];
+  const int mf = m3_f[0]*m3_f[1]*m3_f[2];
+
+  Workspace * workspace = Workspace::instance();
+  enzo_float * array_c = workspace->allocate<enzo_float>(mc);
+  enzo_float * array_f = workspace->allocate<enzo_float>(mf);
+
+  // the fine array is copied too, since only its n3_f region is written
+
+  copy_to_ (array_c, values_c, precision, mc);
+  copy_to_ (array_f, values_f, precision, mf);
+
+  apply_ (array_f,m3_f,o3_f,n3_f,
+          array_c,m3_c,o3_c,n3_c,false);
+
+  copy_from_ (values_f, array_f, precision, mf);
+
+  workspace->release(array_f);
+  workspace->release(array_c);
+}
+
 //----------------------------------------------------------------------
 
 void EnzoProlong::apply_
@@ -136,7 +206,8 @@ void EnzoProlong::apply_
   int size=gdims[0]/2 + 1;
   if (rank >= 2) size*=gdims[1]/2 + 1;
   if (rank >= 3) size*=gdims[2]/2 + 1;
-  enzo_float * work = new enzo_float[2*size+100];
+  Workspace * workspace = Workspace::instance();
+  enzo_float * work = workspace->allocate<enzo_float>(2*size+100);
 
 #ifdef DEBUG_ENZO_PROLONG
   CkPrintf ("DEBUG_ENZO_PROLONG EnzoProlong\n");
@@ -171,7 +242,8 @@ void EnzoProlong::apply_
   int o_f = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
 
   const int mf = m3_f[0]*m3_f[1]*m3_f[2];
-  enzo_float * temp_f = (accumulate) ? (new enzo_float [mf]) : values_f;
+  enzo_float * temp_f = (accumulate) ?
+    workspace->allocate<enzo_float>(mf) : values_f;
 
   FORTRAN_NAME(interpolate)
     (&rank,
@@ -192,8 +264,8 @@ void EnzoProlong::apply_
         }
       }
     }
-    delete [] temp_f;
+    workspace->release(temp_f);
   }
 
-  delete [] work;
+  workspace->release(work);
 }
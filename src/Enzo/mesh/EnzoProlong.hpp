@@ -58,6 +58,13 @@ private: // functions
   ( enzo_float *  values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
     const enzo_float * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
+
+  /// Prolong a field stored at a precision other than enzo_float's by
+  /// converting both arrays to enzo_float
+  void apply_convert_
+  ( precision_type precision,
+    void *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3]);
   
 private: // attributes
 
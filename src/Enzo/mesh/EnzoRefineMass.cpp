@@ -97,119 +97,29 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
   bool all_coarsen = true;
   bool any_refine = false;
 
-  union {
-    float *       rho4;
-    double *      rho8;
-    long double * rho16;
-  };
-  union {
-    float *       out4;
-    double *      out8;
-    long double * out16;
-  };
-
-  rho4 = (float *) field.values(id_field);
-  out4 = (float*) initialize_output_(field.field_data());
+  void * array  = field.values(id_field);
+  void * output = initialize_output_(field.field_data());
 
   double vol = hx*hy*hz;
   
   switch (precision) {
   case precision_single:
-    if (out4) {
-#ifdef DEBUG_REFINE      
-      double min =  std::numeric_limits<float>::max();
-      double max = -min;
-      double sum = 0.0;
-#endif      
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    double mass = vol*rho4[i];
-#ifdef DEBUG_REFINE      
-	    min = std::min(min,mass);
-	    max = std::max(max,mass);
-	    sum += mass;
-#endif	    
-	    if      (mass < mass_max_coarsen) out4[i] = -1;
-	    else if (mass < mass_min_refine)  out4[i] =  0;
-	    else                              out4[i] = +1;
-	  }
-	}
-      }
-#ifdef DEBUG_REFINE      
-      double sum2= 0.0;
-      for (int i=0; i<mx*my*mz; i++) sum2 += vol*rho4[i];
-      CkPrintf ("DEBUG_REFINE_MASS %s sum (%18.15g) [%18.15g]\n",
-		name_.c_str(),sum,sum2);
-      CkPrintf ("DEBUG_REFINE_MASS %s refine %18.15g\n",
-		name_.c_str(),mass_min_refine);
-#endif      
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho4[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_((const float *)array, (float *)output,
+                    mx,my,mz,gx,gy,gz, vol,
+                    mass_min_refine, mass_max_coarsen,
+                    &any_refine, &all_coarsen);
     break;
   case precision_double:
-    if (out8) {
-      double min =  std::numeric_limits<double>::max();
-      double max = -min;
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    double mass = vol*rho8[i];
-	    min = std::min(min,mass);
-	    max = std::max(max,mass);
-	    if      (mass < mass_max_coarsen) out8[i] = -1;
-	    else if (mass < mass_min_refine)  out8[i] =  0;
-	    else                              out8[i] = +1;
-	  }
-	}
-      }
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho8[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_((const double *)array, (double *)output,
+                    mx,my,mz,gx,gy,gz, vol,
+                    mass_min_refine, mass_max_coarsen,
+                    &any_refine, &all_coarsen);
     break;
   case precision_quadruple:
-    if (out16) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    long double mass = vol*rho16[i];
-	    if      (mass < mass_max_coarsen) out16[i] = -1;
-	    else if (mass < mass_min_refine)  out16[i] =  0;
-	    else                              out16[i] = +1;
-	  }
-	}
-      }
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  long double mass = vol*rho16[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_((const long double *)array, (long double *)output,
+                    mx,my,mz,gx,gy,gz, vol,
+                    mass_min_refine, mass_max_coarsen,
+                    &any_refine, &all_coarsen);
     break;
   default:
     ERROR2("EnzoRefineMass::apply",
@@ -228,5 +138,35 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 
 }
 
-//======================================================================
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoRefineMass::evaluate_block_
+(const T * rho, T * output,
+ int mx, int my, int mz,
+ int gx, int gy, int gz,
+ double vol, double mass_min_refine, double mass_max_coarsen,
+ bool * any_refine, bool * all_coarsen) const
+{
+  // single sweep computing both the output field and the result
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	const auto mass = vol*rho[i];
+	if (output) {
+	  if      (mass < mass_max_coarsen) output[i] = -1;
+	  else if (mass < mass_min_refine)  output[i] =  0;
+	  else                              output[i] = +1;
+	}
+	if (mass > mass_max_coarsen) *all_coarsen = false;
+	if (mass > mass_min_refine) {
+	  *any_refine  = true;
+	  if (! output) return;
+	}
+      }
+    }
+  }
+}
 
+//======================================================================
@@ -55,7 +55,20 @@ public: // interface
 
   virtual std::string name () const { return "mass"; };
 
-private:
+private: // functions
+
+  /// Evaluate the criteria over the Block, filling output if not NULL
+  template <class T>
+  void evaluate_block_(const T * rho, T * output,
+                       int mx, int my, int mz,
+                       int gx, int gy, int gz,
+                       double vol,
+                       double mass_min_refine,
+                       double mass_max_coarsen,
+                       bool * any_refine,
+                       bool * all_coarsen) const;
+
+private: // attributes
 
   /// Field containing density to compare against
   std::string name_;
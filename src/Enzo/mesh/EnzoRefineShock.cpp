@@ -27,7 +27,8 @@ EnzoRefineShock::EnzoRefineShock(double pressure_min_refine,
     energy_ratio_min_refine_ (energy_ratio_min_refine),
     energy_ratio_max_coarsen_(energy_ratio_max_coarsen),
     gamma_(gamma),
-    comoving_coordinates_(comoving_coordinates)
+    comoving_coordinates_(comoving_coordinates),
+    rank_(0)
 {
 }
 
@@ -125,68 +126,121 @@ void EnzoRefineShock::evaluate_block_
 
   const int d3[3] = {1, ndx, ndx*ndy};
 
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-  enzo_float dp_min = std::numeric_limits<enzo_float>::max();
-  enzo_float dp_max = -std::numeric_limits<enzo_float>::max();
-  enzo_float er_min = std::numeric_limits<enzo_float>::max();
-  enzo_float er_max = -std::numeric_limits<enzo_float>::max();
-#endif
-  
-  for (int axis=0; axis<rank; axis++) {
+  // single sweep over the block, evaluating all axes at each cell
+  for (int iz=gz; iz<nz+gz; iz++) {
+    for (int iy=gy; iy<ny+gy; iy++) {
+      for (int ix=gx; ix<nx+gx; ix++) {
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+	int i = ix + ndx*(iy + ndy*iz);
 
-	  int i = ix + ndx*(iy + ndy*iz);
-	  int id = d3[axis];
+	const int result = evaluate_cell_(v3,te,de,p,i,d3,rank);
 
-	  enzo_float dp = fabs    (p[i+id] - p[i-id]) 
-	    / (std::min(p[i+id] , p[i-id])) ;
+	if (result != adapt_coarsen) *all_coarsen = false;
+	if (result == adapt_refine) {
+	  *any_refine = true;
+	  if (! output) return;
+	}
 
-	  enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
+	if (output) {
+	  if (result == adapt_same)   output[i] =  0;
+	  if (result == adapt_refine) output[i] = +1;
+	}
+      }
+    }
+  }
+}
+//----------------------------------------------------------------------
 
-	  enzo_float e = p[i]/(gamma_ - 1.0);
+int EnzoRefineShock::evaluate_cell_
+(const enzo_float * const v3[],
+ const enzo_float * te,
+ const enzo_float * de,
+ const enzo_float * p,
+ int i, const int d3[3], int rank) const throw()
+{
+  bool l_refine = false;
+  bool l_same   = false;
 
-	  enzo_float ep = te[i+id]*de[i+id];
-	  enzo_float e0 = te[i]   *de[i];
-	  enzo_float em = te[i-id]*de[i-id];
+  for (int axis=0; axis<rank; axis++) {
 
-	  enzo_float er = e / std::max (std::max(em,e0),ep);
+    int id = d3[axis];
 
-	  bool l_refine = (dv < 0.0) && 
-	    (dp > pressure_min_refine_) &&
-	    (er > energy_ratio_min_refine_);
+    enzo_float dp = fabs    (p[i+id] - p[i-id]) 
+      / (std::min(p[i+id] , p[i-id])) ;
 
-	  bool l_same = (dv < 0.0) &&
-	    (dp > pressure_max_coarsen_) &&
-	    (er > energy_ratio_max_coarsen_);
+    enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
 
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-	  dp_min = std::min(dp_min,dp);
-	  dp_max = std::max(dp_max,dp);
-	  er_min = std::min(er_min,er);
-	  er_max = std::max(er_max,er);
-#endif
-	  if (l_refine)  *any_refine = true;
-	  if (l_same)    *all_coarsen = false;
+    enzo_float e = p[i]/(gamma_ - 1.0);
 
-	  if (output) {
-	    if (l_same)   output[i] =  0;
-	    if (l_refine) output[i] = +1;
-	  }
-	}
-      }
-    }
+    enzo_float ep = te[i+id]*de[i+id];
+    enzo_float e0 = te[i]   *de[i];
+    enzo_float em = te[i-id]*de[i-id];
+
+    enzo_float er = e / std::max (std::max(em,e0),ep);
+
+    l_refine = l_refine || ((dv < 0.0) && 
+			    (dp > pressure_min_refine_) &&
+			    (er > energy_ratio_min_refine_));
+
+    l_same = l_same || ((dv < 0.0) &&
+			(dp > pressure_max_coarsen_) &&
+			(er > energy_ratio_max_coarsen_));
   }
-#ifdef DEBUG_ENZO_REFINE_SHOCK
-  CkPrintf ("%s dp limits %lf %lf  dp min/max %lf %lf\n",
-	    pressure_max_coarsen_,pressure_min_refine_,
-	    dp_min,dp_max);
-  CkPrintf ("%s er limits %lf %lf  er min/max %lf %lf\n",
-	    energy_ratio_max_coarsen_,energy_ratio_min_refine_,
-	    er_min,er_max);
-#endif  
+
+  return l_refine ? adapt_refine : (l_same ? adapt_same : adapt_coarsen);
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoRefineShock::prepare
+(Block * block, int m3[3], int i3[3], int n3[3]) throw()
+{
+  if (has_output()) return false;
+
+  Field field = block->data()->field();
+
+  int id_velocity = field.field_id("velocity_x");
+
+  ASSERT("EnzoRefineShock::prepare",
+	  "velocity_x field must be defined",
+	 (id_velocity >= 0));
+
+  EnzoComputePressure compute_pressure (gamma_,comoving_coordinates_);
+  compute_pressure.compute(block);
+
+  rank_ = cello::rank();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+
+  int gx,gy,gz;
+  field.ghost_depth(id_velocity, &gx,&gy,&gz);
+
+  m3[0] = nx + 2*gx;
+  m3[1] = ny + 2*gy;
+  m3[2] = nz + 2*gz;
+
+  i3[0] = (rank_ >= 1) ? gx : 0;
+  i3[1] = (rank_ >= 2) ? gy : 0;
+  i3[2] = (rank_ >= 3) ? gz : 0;
+
+  n3[0] = nx;
+  n3[1] = ny;
+  n3[2] = nz;
+
+  v3_[0] = (rank_ >= 1) ? (const enzo_float *) field.values("velocity_x") : 0;
+  v3_[1] = (rank_ >= 2) ? (const enzo_float *) field.values("velocity_y") : 0;
+  v3_[2] = (rank_ >= 3) ? (const enzo_float *) field.values("velocity_z") : 0;
+  te_ = (const enzo_float *) field.values("total_energy");
+  de_ = (const enzo_float *) field.values("density");
+  p_  = (const enzo_float *) field.values("pressure");
+
+  d3_[0] = 1;
+  d3_[1] = m3[0];
+  d3_[2] = m3[0]*m3[1];
+
+  return true;
 }
+
 //======================================================================
 
@@ -41,7 +41,8 @@ public: // interface
       energy_ratio_min_refine_(0.0),
       energy_ratio_max_coarsen_(0.0),
       gamma_(0.0),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      rank_(0)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -66,8 +67,23 @@ public: // interface
 
   virtual std::string name () const { return "shock"; };
 
+  /// Computes the pressure field before evaluating cells
+  virtual bool prepare (Block * block, int m3[3], int i3[3], int n3[3])
+    throw();
+
+  virtual int evaluate_cell (int i) const throw()
+  { return evaluate_cell_(v3_,te_,de_,p_,i,d3_,rank_); }
+
 private: // functions
 
+  /// Evaluate the criteria at index i: adapt_refine, adapt_same or
+  /// adapt_coarsen
+  int evaluate_cell_ (const enzo_float * const v3[],
+		      const enzo_float * te,
+		      const enzo_float * de,
+		      const enzo_float * p,
+		      int i, const int d3[3], int rank) const throw();
+
   void evaluate_block_( const enzo_float ** v3,
 			const enzo_float * te,
 			const enzo_float * de,
@@ -99,6 +115,15 @@ private: // attributes
 
   /// Comoving coordinates
   bool comoving_coordinates_;
+
+  /// Fields, index strides and rank of the Block set by prepare()
+  /// (not checkpointed)
+  const enzo_float * v3_[3];
+  const enzo_float * te_;
+  const enzo_float * de_;
+  const enzo_float * p_;
+  int d3_[3];
+  int rank_;
 };
 
 #endif /* ENZO_ENZO_REFINE_SHOCK_HPP */
@@ -37,6 +37,11 @@ public: // interface
   virtual std::string name () throw () 
   { return "pm_update"; }
 
+  /// Only particles are modified
+  virtual bool modifies_field (const std::string & field_name)
+    const throw()
+  { return false; }
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
@@ -187,39 +187,50 @@ int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double * eWinds, do
 void EnzoMethodFeedbackSTARSS::transformComovingWithStar(enzo_float * density, 
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw()
+                                  const int mx, const int my, const int mz,
+                                  const int ix0, const int iy0, const int iz0,
+                                  const int nx0, const int ny0, const int nz0,
+                                  int direction) const throw()
 {
-  int size = mx*my*mz;
   if (direction > 0)
   {
     // to comoving with star
     // NOTE: This transforms the velocity field into a momentum density
     //       field for the sake of depositing momentum easily
- 
-    for (int ind = 0; ind<size; ind++) {
-      double mult = density[ind];
-      velocity_x[ind] = (velocity_x[ind]-up)*mult;
-      velocity_y[ind] = (velocity_y[ind]-vp)*mult;
-      velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+
+    for (int iz=iz0; iz<iz0+nz0; iz++) {
+      for (int iy=iy0; iy<iy0+ny0; iy++) {
+        for (int ix=ix0; ix<ix0+nx0; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          double mult = density[ind];
+          velocity_x[ind] = (velocity_x[ind]-up)*mult;
+          velocity_y[ind] = (velocity_y[ind]-vp)*mult;
+          velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+        }
+      }
     }
   }
 
   else if (direction < 0)
   {
     // back to "lab" frame. Convert momentum density field back to velocity
-    for (int ind = 0; ind<size; ind++) {
-      //if (density[ind] <= 10*1e-20) continue;
-      if (density[ind] == 0) continue;
-      double mult = 1/density[ind];
-      velocity_x[ind] = velocity_x[ind]*mult + up;
-      velocity_y[ind] = velocity_y[ind]*mult + vp;
-      velocity_z[ind] = velocity_z[ind]*mult + wp;
+    for (int iz=iz0; iz<iz0+nz0; iz++) {
+      for (int iy=iy0; iy<iy0+ny0; iy++) {
+        for (int ix=ix0; ix<ix0+nx0; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          //if (density[ind] <= 10*1e-20) continue;
+          if (density[ind] == 0) continue;
+          double mult = 1/density[ind];
+          velocity_x[ind] = velocity_x[ind]*mult + up;
+          velocity_y[ind] = velocity_y[ind]*mult + vp;
+          velocity_z[ind] = velocity_z[ind]*mult + wp;
+        }
+      }
     }
   }
 
 }
 
-
 double EnzoMethodFeedbackSTARSS::Window(double xd, double yd, double zd, double width) const throw()
 {
     float wx = 0, wy = 0, wz = 0;
@@ -836,8 +847,6 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   my = ny + 2*gy;
   mz = nz + 2*gz;
 
-  int size = mx*my*mz;
-
   const int rank = cello::rank();
 
   double cell_volume_code = hx*hy*hz;
@@ -897,28 +906,27 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   // holds just shell densities (used for refresh+accumulate)
   enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
 
-  // allocate another set of temporary deposit fields for this event 
-  enzo_float *  d_dep = new enzo_float[size]; 
-  enzo_float * te_dep = new enzo_float[size];
-  enzo_float * ge_dep = new enzo_float[size];
-  enzo_float * mf_dep = new enzo_float[size];
-  enzo_float * vx_dep = new enzo_float[size];
-  enzo_float * vy_dep = new enzo_float[size];
-  enzo_float * vz_dep = new enzo_float[size];
-
-  // initialize temporary deposit fields as zero
-  // Not doing so gives in screwy results
-  for (int i=0; i<size; i++) {
-    d_dep [i] = 0;
-    te_dep[i] = 0;
-    ge_dep[i] = 0;
-    mf_dep[i] = 0;
-    vx_dep[i] = 0;
-    vy_dep[i] = 0;
-    vz_dep[i] = 0;
-  }
-
-
+  // This event only touches cells within two cells of the star: the
+  // coupling particles sit one cell width from it and are CiC deposited
+  // with a cloud one cell wide.  Accumulate the event into a small local
+  // stencil rather than full-block arrays, and merge only those cells.
+  // The stencil is shifted if needed so that it lies within the block.
+  const int n_stencil = 5;
+  int nsx = std::min(n_stencil, mx);
+  int nsy = std::min(n_stencil, my);
+  int nsz = std::min(n_stencil, mz);
+  const int ix0 = std::max(0, std::min(ix - n_stencil/2, mx - nsx));
+  const int iy0 = std::max(0, std::min(iy - n_stencil/2, my - nsy));
+  const int iz0 = std::max(0, std::min(iz - n_stencil/2, mz - nsz));
+
+  // temporary deposit fields for this event, initialized to zero
+  enzo_float  d_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float te_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float ge_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float mf_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float vx_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float vy_dep[n_stencil*n_stencil*n_stencil] = {};
+  enzo_float vz_dep[n_stencil*n_stencil*n_stencil] = {};
 
   const int index = INDEX(ix,iy,iz,mx,my);
 
@@ -965,8 +973,10 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
          around is velocity
      */
   
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, 1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, 1);
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz,
+                                  ix0,iy0,iz0,nsx,nsy,nsz, 1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz,
+                                  ix0,iy0,iz0,nsx,nsy,nsz, 1);
 
   const GrackleChemistryData * grackle_chem = enzo::grackle_chemistry();
   const int primordial_chemistry = (grackle_chem == nullptr) ?
@@ -1318,6 +1328,7 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
       for (int iy_ = iy-1; iy_ <= iy+1; iy_++) {
         for (int iz_ = iz-1; iz_ <= iz+1; iz_++) {
           int flat = INDEX(ix_,iy_,iz_,mx,my);
+          int flat_s = INDEX(ix_-ix0,iy_-iy0,iz_-iz0,nsx,nsy);
 
           // cell left edges for CiC (starting from ghost zones)
           double xcell = xm + (ix_+0.5 - gx)*hx; 
@@ -1332,15 +1343,15 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
           double pre_z_frac = zpre / dpre;
 
           // subtract values from the "deposit" fields
-          d_dep[flat] -= std::min(window * remainMass, maxEvacFraction*dpre);
+          d_dep[flat_s] -= std::min(window * remainMass, maxEvacFraction*dpre);
 
-          minusRho    += -1*d_dep[flat];
-          msubtracted += -1*d_dep[flat];
+          minusRho    += -1*d_dep[flat_s];
+          msubtracted += -1*d_dep[flat_s];
          
-          mf_dep[flat] -= std::min(window * remainZ, maxEvacFraction*zpre); 
+          mf_dep[flat_s] -= std::min(window * remainZ, maxEvacFraction*zpre); 
 
-          minusZ      += -1*mf_dep[flat];
-          zsubtracted += -1*mf_dep[flat];
+          minusZ      += -1*mf_dep[flat_s];
+          zsubtracted += -1*mf_dep[flat_s];
 
         } // endfor iz_
       } // endfor iy_
@@ -1417,42 +1428,43 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
     coupledGasEnergy_list[n] = coupledGasEnergy/nCouple;
   }
   enzo_float left_edge[3] = {xm-gx*hx, ym-gy*hy, zm-gz*hz};
+  enzo_float left_edge_s[3] = {xm+(ix0-gx)*hx, ym+(iy0-gy)*hy, zm+(iz0-gz)*hz};
 
   // CiC deposit mass/energy/momentum
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMass_list, d_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_x, vx_dep, &left_edge,
-   &mx, &my, &mz, &hx, &hx);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_x, vx_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &hx);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_y, vy_dep, &left_edge,
-   &mx, &my, &mz, &hx, &hx);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_y, vy_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &hx);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_z, vz_dep, &left_edge,
-   &mx, &my, &mz, &hx, &hx);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMomenta_z, vz_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &hx);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledMetals_list, mf_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledMetals_list, mf_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledEnergy_list, te_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledEnergy_list, te_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
-   &CloudParticlePositionZ, &rank, &nCouple, &coupledGasEnergy_list, ge_dep, &left_edge,
-   &mx, &my, &mz, &hx, &A);
+   &CloudParticlePositionZ, &rank, &nCouple, &coupledGasEnergy_list, ge_dep, &left_edge_s,
+   &nsx, &nsy, &nsz, &hx, &A);
 
   FORTRAN_NAME(cic_deposit)
   (&CloudParticlePositionX, &CloudParticlePositionY,
@@ -1460,55 +1472,54 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
    &mx, &my, &mz, &hx, &A);
 
   // copy deposited quantites to original fields
-  for (int i=0; i<size; i++){
-    double d_old = d[i]; 
-    d[i] += d_dep[i];
-    double d_new = d[i];
-
-    double cell_mass = d_new*cell_volume_code;
-    double M_scale = d_new / d_old;
-
-    mf[i] += mf_dep[i]; 
-
-    // need to rescale specific energies to account for added mass
-    te[i] = te[i]/M_scale + te_dep[i]/d_new;
-    ge[i] = ge[i]/M_scale + ge_dep[i]/d_new;
-
-    vx[i] += vx_dep[i];
-    vy[i] += vy_dep[i];
-    vz[i] += vz_dep[i];
-    // Rescale color fields to account for new densities.
-    // Don't need to rescale metal_density because we already deposited
-    // into the metal_density field.
-
-    EnzoMethodStarMaker::rescale_densities(enzo_block, i, d_new/d_old);
-
-    // undo rescaling of metal_density
-    mf[i] /= (d_new/d_old);
-
-    // add deposited quantities to fields that track depositions
-    // of all star particles in the block this cycle
-     d_dep_tot[i] += d_dep[i];
-    mf_dep_tot[i] += mf_dep[i];
-    te_dep_tot[i] += te_dep[i];
-    ge_dep_tot[i] += ge_dep[i];
-    vx_dep_tot[i] += vx_dep[i];
-    vy_dep_tot[i] += vy_dep[i];
-    vz_dep_tot[i] += vz_dep[i];
+  for (int iz_s=0; iz_s<nsz; iz_s++) {
+    for (int iy_s=0; iy_s<nsy; iy_s++) {
+      for (int ix_s=0; ix_s<nsx; ix_s++) {
+        const int i_s = INDEX(ix_s,iy_s,iz_s,nsx,nsy);
+        const int i   = INDEX(ix0+ix_s,iy0+iy_s,iz0+iz_s,mx,my);
+
+        double d_old = d[i]; 
+        d[i] += d_dep[i_s];
+        double d_new = d[i];
+
+        double M_scale = d_new / d_old;
+
+        mf[i] += mf_dep[i_s]; 
+
+        // need to rescale specific energies to account for added mass
+        te[i] = te[i]/M_scale + te_dep[i_s]/d_new;
+        ge[i] = ge[i]/M_scale + ge_dep[i_s]/d_new;
+
+        vx[i] += vx_dep[i_s];
+        vy[i] += vy_dep[i_s];
+        vz[i] += vz_dep[i_s];
+        // Rescale color fields to account for new densities.
+        // Don't need to rescale metal_density because we already deposited
+        // into the metal_density field.
+
+        EnzoMethodStarMaker::rescale_densities(enzo_block, i, d_new/d_old);
+
+        // undo rescaling of metal_density
+        mf[i] /= (d_new/d_old);
+
+        // add deposited quantities to fields that track depositions
+        // of all star particles in the block this cycle
+         d_dep_tot[i] += d_dep[i_s];
+        mf_dep_tot[i] += mf_dep[i_s];
+        te_dep_tot[i] += te_dep[i_s];
+        ge_dep_tot[i] += ge_dep[i_s];
+        vx_dep_tot[i] += vx_dep[i_s];
+        vy_dep_tot[i] += vy_dep[i_s];
+        vz_dep_tot[i] += vz_dep[i_s];
+      }
+    }
   }
   // transform velocities back to "lab" frame
   // convert velocity (actually momentum density at the moment) field back to velocity 
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, -1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, -1);
-
-  // clear temporary fields 
-  delete []  d_dep;
-  delete [] mf_dep;
-  delete [] te_dep;
-  delete [] ge_dep;
-  delete [] vx_dep;
-  delete [] vy_dep;
-  delete [] vz_dep;
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz,
+                                  ix0,iy0,iz0,nsx,nsy,nsz, -1);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz,
+                                  ix0,iy0,iz0,nsx,nsy,nsz, -1);
 }
 
 
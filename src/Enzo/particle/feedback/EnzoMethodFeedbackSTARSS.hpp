@@ -65,10 +65,16 @@ public:
                           const int winds, const int nSNII, const int nSNIa,
                           const double starZ) const throw();
 
+   /// transform velocity to (direction > 0) or from (direction < 0)
+   /// momentum density comoving with the star, in the nx0*ny0*nz0 box
+   /// of cells starting at (ix0,iy0,iz0)
    void transformComovingWithStar(enzo_float * density,
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw();
+                                  const int mx, const int my, const int mz,
+                                  const int ix0, const int iy0, const int iz0,
+                                  const int nx0, const int ny0, const int nz0,
+                                  int direction) const throw();
 
    void add_accumulate_fields(EnzoBlock * enzo_block) throw();
 
@@ -150,6 +150,11 @@ void EnzoComputeCicInterp::compute_(Block * block)
       enzo_float * vya = lshift ?
 	(enzo_float *) particle.attribute_array (it_p_,ia_vy,ib) : nullptr;
 
+      // field values at the current cell's corners, reloaded only
+      // when the cell changes (rarely if particles are sorted by cell)
+      int i0_run = -1;
+      enzo_float f00=0.0, f01=0.0, f10=0.0, f11=0.0;
+
       for (int ip=0; ip<np; ip++) {
 
 	enzo_float x = lshift ? xa[ip*dp] + dt_*vxa[ip*dv] : xa[ip*dp];
@@ -167,10 +172,18 @@ void EnzoComputeCicInterp::compute_(Block * block)
 	enzo_float x1 = 1.0 - x0;
 	enzo_float y1 = 1.0 - y0;
 
-	enzo_float * vf0 = vf+ix0+mx*iy0;
-	
-	vp[ip*da] = x0*(y0*vf0[i000] + y1*vf0[i010])
-	  +         x1*(y0*vf0[i100] + y1*vf0[i110]);
+	const int i0 = ix0+mx*iy0;
+	if (i0 != i0_run) {
+	  const enzo_float * vf0 = vf + i0;
+	  f00 = vf0[i000];
+	  f01 = vf0[i010];
+	  f10 = vf0[i100];
+	  f11 = vf0[i110];
+	  i0_run = i0;
+	}
+
+	vp[ip*da] = x0*(y0*f00 + y1*f01)
+	  +         x1*(y0*f10 + y1*f11);
 
       }
     }
@@ -194,6 +207,12 @@ void EnzoComputeCicInterp::compute_(Block * block)
       enzo_float * vza = lshift ?
 	(enzo_float *) particle.attribute_array (it_p_,ia_vz,ib) : nullptr;
       
+      // field values at the current cell's corners, reloaded only
+      // when the cell changes (rarely if particles are sorted by cell)
+      int i0_run = -1;
+      enzo_float f000=0.0, f001=0.0, f010=0.0, f011=0.0;
+      enzo_float f100=0.0, f101=0.0, f110=0.0, f111=0.0;
+
       for (int ip=0; ip<np; ip++) {
 
 	enzo_float x = lshift ? xa[ip*dp] + dt_*vxa[ip*dv] : xa[ip*dp];
@@ -216,12 +235,24 @@ void EnzoComputeCicInterp::compute_(Block * block)
 	enzo_float y1 = 1.0 - y0;
 	enzo_float z1 = 1.0 - z0;
 
-	enzo_float * vf0 = vf + ix0+mx*(iy0+my*iz0);
-
-	vp[ip*da] = x0*(y0*(z0*vf0[i000] + z1*vf0[i001]) +
-			y1*(z0*vf0[i010] + z1*vf0[i011])) 
-	  +         x1*(y0*(z0*vf0[i100] + z1*vf0[i101]) +
-			y1*(z0*vf0[i110] + z1*vf0[i111]));
+	const int i0 = ix0+mx*(iy0+my*iz0);
+	if (i0 != i0_run) {
+	  const enzo_float * vf0 = vf + i0;
+	  f000 = vf0[i000];
+	  f001 = vf0[i001];
+	  f010 = vf0[i010];
+	  f011 = vf0[i011];
+	  f100 = vf0[i100];
+	  f101 = vf0[i101];
+	  f110 = vf0[i110];
+	  f111 = vf0[i111];
+	  i0_run = i0;
+	}
+
+	vp[ip*da] = x0*(y0*(z0*f000 + z1*f001) +
+			y1*(z0*f010 + z1*f011))
+	  +         x1*(y0*(z0*f100 + z1*f101) +
+			y1*(z0*f110 + z1*f111));
       }
     }
   }
@@ -0,0 +1,214 @@
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+_description = '''\
+Runs an Enzo-E performance benchmark (the command is specified by COMMAND and
+its arguments by ARGS), collects the "Performance" counters written by the
+Monitor and the cell-update throughput into a JSON file, and optionally
+compares the results against a stored baseline. An exit code of 0 indicates
+that the run completed and no metric regressed beyond the tolerance.
+'''
+
+parser = argparse.ArgumentParser(description = _description)
+parser.add_argument(
+    "--name", action = "store", required = True,
+    help = "name of the benchmark, used as its key in the baseline file"
+)
+parser.add_argument(
+    "--output-dump", action = "store", default = None,
+    help = "path where a copy of the standard output stream is written"
+)
+parser.add_argument(
+    "--output-json", action = "store", required = True,
+    help = "path where the benchmark results are written as JSON"
+)
+parser.add_argument(
+    "--baseline", action = "store", default = None,
+    help = ("JSON file of baseline results keyed by benchmark name. If the "
+            "file or the benchmark entry does not exist, no comparison is "
+            "made.")
+)
+parser.add_argument(
+    "--tolerance", action = "store", type = float, default = 0.2,
+    help = ("allowed relative regression of each metric with respect to the "
+            "baseline (default 0.2)")
+)
+parser.add_argument(
+    "--update-baseline", action = "store_true", default = False,
+    help = ("store the results of this run in the baseline file instead of "
+            "comparing against it")
+)
+parser.add_argument(
+    "command", metavar = "COMMAND", action = "store",
+    help = "the command that runs the benchmark"
+)
+parser.add_argument(
+    "args_for_command", metavar = "ARGS", action = "store",
+    nargs = argparse.REMAINDER, default = [],
+    help = "the arguments to the command"
+)
+
+# Monitor output lines have the form "<pe> <time> <component> <message>"
+_monitor_line = re.compile(r'^\s*\d+\s+([0-9.]+)\s+(\S+)\s+(.*)$')
+
+# Performance messages ending in a single integer value
+_counter_message = re.compile(r'^(.*\S)\s+(-?\d+)$')
+
+# Counters compared against the baseline: larger values are regressions
+_lower_is_better = ['cycle time-usec', 'simulation time-usec']
+
+def execute_command(command, args, output_dump):
+    """
+    Executes the command, returning its exit code and standard output (which
+    is also echoed to stdout and optionally written to output_dump)
+    """
+    proc = subprocess.Popen([command] + args, stdout = subprocess.PIPE,
+                            universal_newlines = True)
+    lines = []
+    for line in proc.stdout:
+        sys.stdout.write(line)
+        lines.append(line)
+    proc.wait()
+    if output_dump is not None:
+        with open(output_dump, 'w') as f:
+            f.writelines(lines)
+    return proc.returncode, lines
+
+def parse_monitor_output(lines):
+    """
+    Returns the benchmark metrics parsed from the Monitor output.
+
+    The "Simulation cycle" line of each cycle and its time stamp delimit the
+    cycles; the number of leaf cells reported by the Performance output of a
+    cycle is the number of cells updated during the following cycle.
+    Counters are those reported by the last Performance output.
+    """
+    cycle_times = []
+    leaf_cells = []
+    counters = {}
+    for line in lines:
+        match = _monitor_line.match(line)
+        if match is None:
+            continue
+        time, component, message = match.groups()
+        if component == 'Simulation' and message.startswith('cycle '):
+            cycle_times.append((int(message.split()[1]), float(time)))
+        elif component == 'Performance':
+            counter = _counter_message.match(message)
+            if counter is None:
+                continue
+            name, value = counter.group(1), int(counter.group(2))
+            if name == 'simulation num-leaf-cells':
+                leaf_cells.append(value)
+            counters[name] = value
+
+    if len(cycle_times) < 2:
+        raise RuntimeError("fewer than two cycles found in the output")
+
+    num_cycles = cycle_times[-1][0] - cycle_times[0][0]
+    wall_seconds = cycle_times[-1][1] - cycle_times[0][1]
+    cell_updates = sum(leaf_cells[:len(cycle_times)-1])
+    cell_updates_per_second = (cell_updates / wall_seconds
+                               if wall_seconds > 0.0 else 0.0)
+
+    return {'cycles' : num_cycles,
+            'wall_seconds' : wall_seconds,
+            'cell_updates' : cell_updates,
+            'cell_updates_per_second' : cell_updates_per_second,
+            'counters' : counters}
+
+def compare_to_baseline(name, results, baseline, tolerance):
+    """
+    Returns a list of messages describing each metric of results that
+    regressed by more than tolerance relative to baseline
+    """
+    failures = []
+
+    def _check(metric, value, reference, higher_is_better):
+        if higher_is_better:
+            regressed = value < (1.0 - tolerance) * reference
+        else:
+            regressed = value > (1.0 + tolerance) * reference
+        status = 'REGRESSION' if regressed else 'ok'
+        print('perf {} {}: {:g} baseline {:g} [{}]'.format(
+            name, metric, value, reference, status))
+        if regressed:
+            failures.append(metric)
+
+    if 'cell_updates_per_second' in baseline:
+        _check('cell_updates_per_second', results['cell_updates_per_second'],
+               baseline['cell_updates_per_second'], True)
+
+    for counter, reference in baseline.get('counters', {}).items():
+        if counter not in results['counters']:
+            print('perf {} {}: missing from output'.format(name, counter))
+            failures.append(counter)
+        else:
+            _check(counter, results['counters'][counter], reference, False)
+
+    return failures
+
+def update_baseline(path, name, results):
+    """
+    Stores the throughput and timing counters of results as the baseline
+    entry for name in the file at path
+    """
+    baselines = {}
+    if os.path.isfile(path):
+        with open(path, 'r') as f:
+            baselines = json.load(f)
+    baselines[name] = {
+        'cell_updates_per_second' : results['cell_updates_per_second'],
+        'counters' : {counter : results['counters'][counter]
+                      for counter in _lower_is_better
+                      if counter in results['counters']}
+    }
+    with open(path, 'w') as f:
+        json.dump(baselines, f, indent = 2, sort_keys = True)
+        f.write('\n')
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+
+    exit_code, lines = execute_command(args.command, args.args_for_command,
+                                       args.output_dump)
+    if exit_code != 0:
+        print('perf {}: command failed with exit code {}'.format(
+            args.name, exit_code))
+        sys.exit(1)
+
+    results = parse_monitor_output(lines)
+    results['name'] = args.name
+    with open(args.output_json, 'w') as f:
+        json.dump(results, f, indent = 2, sort_keys = True)
+        f.write('\n')
+
+    print('perf {}: {} cycles {:.3f} s {:.4g} cell-updates/s'.format(
+        args.name, results['cycles'], results['wall_seconds'],
+        results['cell_updates_per_second']))
+
+    if args.baseline is None:
+        sys.exit(0)
+
+    if args.update_baseline:
+        update_baseline(args.baseline, args.name, results)
+        print('perf {}: baseline updated in {}'.format(
+            args.name, args.baseline))
+        sys.exit(0)
+
+    baseline = None
+    if os.path.isfile(args.baseline):
+        with open(args.baseline, 'r') as f:
+            baseline = json.load(f).get(args.name, None)
+    if baseline is None:
+        print('perf {}: no baseline in {}, skipping comparison'.format(
+            args.name, args.baseline))
+        sys.exit(0)
+
+    failures = compare_to_baseline(args.name, results, baseline,
+                                   args.tolerance)
+    sys.exit(1 if failures else 0)